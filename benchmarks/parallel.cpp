@@ -0,0 +1,124 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file parallel.cpp
+ *
+ * @brief Parallel parser throughput benchmark
+ */
+
+#include "json/parser.hpp"
+#include "json/parallel_parser.hpp"
+#include "json/allocator/standard.hpp"
+
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr std::size_t MEGABYTE{1024 * 1024};
+static constexpr std::size_t DEFAULT_SIZE{256};
+static constexpr unsigned ITERATIONS{3};
+
+static std::string generate_records(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "  {\"id\": " + number +
+            ", \"name\": \"item-" + number + "\"" +
+            ", \"tags\": [\"alpha\", \"beta\", \"gamma\"]" +
+            ", \"value\": " + number + ".25e-3" +
+            ", \"active\": true, \"parent\": null}";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+template<typename F>
+static double measure(const std::string& document, F function) {
+    double best = 0.0;
+
+    for (unsigned i = 0; i < ITERATIONS; ++i) {
+        auto start = Clock::now();
+        function(document);
+        auto stop = Clock::now();
+
+        std::chrono::duration<double> elapsed = stop - start;
+        auto throughput = double(document.size()) / double(MEGABYTE) /
+            elapsed.count();
+
+        if (throughput > best) {
+            best = throughput;
+        }
+    }
+
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t size = DEFAULT_SIZE;
+
+    if (argc > 1) {
+        size = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    auto document = generate_records(size * MEGABYTE);
+
+    std::cout << "Records: " << document.size() << " bytes, " <<
+        std::thread::hardware_concurrency() << " threads" << std::endl;
+
+    auto sequential = measure(document, [] (const std::string& str) {
+            json::allocator::Standard allocator;
+            json::Parser parser{allocator};
+            parser.parse(str.data(), str.size());
+        });
+
+    std::cout << "  sequential: " << sequential << " MB/s" << std::endl;
+
+    /* Threads with their own arenas against threads sharing one thread
+     * safe allocator */
+    for (json::Size threads = 1;
+            threads <= std::max(std::thread::hardware_concurrency(), 2u);
+            threads *= 2) {
+        auto arenas = measure(document, [threads] (const std::string& str) {
+                json::ParallelParser parser{threads};
+                parser.parse(str.data(), str.size());
+            });
+
+        auto shared = measure(document, [threads] (const std::string& str) {
+                json::allocator::Standard allocator;
+                json::ParallelParser parser{allocator, threads};
+                parser.parse(str.data(), str.size());
+            });
+
+        std::cout << "  " << threads << " threads: " << arenas <<
+            " MB/s arenas, " << shared << " MB/s shared" << std::endl;
+    }
+}
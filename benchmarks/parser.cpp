@@ -0,0 +1,274 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file parser.cpp
+ *
+ * @brief Parser throughput benchmark
+ */
+
+#include "json/parser.hpp"
+#include "json/document.hpp"
+#include "json/reader.hpp"
+#include "json/validate.hpp"
+#include "json/allocator/standard.hpp"
+
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr std::size_t MEGABYTE{1024 * 1024};
+static constexpr std::size_t DEFAULT_SIZE{16};
+static constexpr unsigned ITERATIONS{5};
+
+static std::string generate_records(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "  {\"id\": " + number +
+            ", \"name\": \"item-" + number + "\"" +
+            ", \"tags\": [\"alpha\", \"beta\", \"gamma\"]" +
+            ", \"value\": " + number + ".25e-3" +
+            ", \"active\": true, \"parent\": null}";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+static std::string generate_logs(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "  {\"level\": \"info\", \"message\": \"request " +
+            number + " served from upstream cache, latency within budget, "
+            "no retries were necessary and the connection was reused\", "
+            "\"path\": \"/api/v1/items/" + number + "/details\"}";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+static std::string generate_metrics(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "  {\"timestamp\": 17000000" + number +
+            ", \"values\": [" + number + ".1234567891, -0.000" + number +
+            "25, 98765.43210" + number + ", 1.5e-" + std::to_string(id % 300) +
+            ", 3141592653589793" + number + "]}";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+/* Short tokens without whitespace, every few bytes end in an action */
+static std::string generate_dense(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",";
+        }
+
+        document += "[" + number + "," + std::to_string(id * 31) +
+            ",true,null,\"x\",{\"a\":" + std::to_string(id % 97) + "}]";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+namespace {
+
+class Counter : public json::Handler<Counter> {
+public:
+    bool number(const json::Number&) noexcept {
+        ++count;
+        return true;
+    }
+
+    bool string(const json::StringView&) noexcept {
+        ++count;
+        return true;
+    }
+
+    json::Size count{0};
+};
+
+/* Keeps only the first member of every object */
+class Selector : public json::Handler<Selector> {
+public:
+    bool key(const json::StringView&) noexcept {
+        if (members++) {
+            parser->skip_value();
+        }
+        return true;
+    }
+
+    bool start_object() noexcept {
+        members = 0;
+        return true;
+    }
+
+    json::BasicParser<Selector>* parser{nullptr};
+    json::Size members{0};
+};
+
+}
+
+template<typename F>
+static double measure(const std::string& document, F function) {
+    double best = 0.0;
+
+    for (unsigned i = 0; i < ITERATIONS; ++i) {
+        json::allocator::Standard allocator;
+        json::Parser parser{allocator};
+
+        auto start = Clock::now();
+        function(parser, document);
+        auto stop = Clock::now();
+
+        std::chrono::duration<double> elapsed = stop - start;
+        auto throughput = double(document.size()) / double(MEGABYTE) /
+            elapsed.count();
+
+        if (throughput > best) {
+            best = throughput;
+        }
+    }
+
+    return best;
+}
+
+static void run(const char* name, const std::string& document) {
+    std::cout << name << ": " << document.size() << " bytes" << std::endl;
+
+    auto put = measure(document,
+        [] (json::Parser& parser, const std::string& str) {
+            for (auto ch : str) {
+                parser.put(ch);
+            }
+        });
+
+    std::cout << "  put():   " << put << " MB/s" << std::endl;
+
+    auto parse = measure(document,
+        [] (json::Parser& parser, const std::string& str) {
+            parser.parse(str.data(), str.size());
+        });
+
+    std::cout << "  parse(): " << parse << " MB/s" << std::endl;
+
+    auto handler = measure(document,
+        [] (json::Parser&, const std::string& str) {
+            Counter counter;
+            json::BasicParser<Counter> parser{counter};
+            parser.parse(str.data(), str.size());
+        });
+
+    std::cout << "  handler: " << handler << " MB/s" << std::endl;
+
+    auto skip = measure(document,
+        [] (json::Parser&, const std::string& str) {
+            Selector selector;
+            json::BasicParser<Selector> parser{selector};
+            selector.parser = &parser;
+            parser.parse(str.data(), str.size());
+        });
+
+    std::cout << "  skip:    " << skip << " MB/s" << std::endl;
+
+    auto validate = measure(document,
+        [] (json::Parser&, const std::string& str) {
+            json::validate(str.data(), str.size());
+        });
+
+    std::cout << "  validate: " << validate << " MB/s" << std::endl;
+
+    auto reader = measure(document,
+        [] (json::Parser&, const std::string& str) {
+            json::Reader tokens{str.data(), str.size()};
+            json::Size count = 0;
+
+            while (tokens.next()) {
+                ++count;
+            }
+        });
+
+    std::cout << "  reader:  " << reader << " MB/s" << std::endl;
+
+    auto lazy = measure(document,
+        [] (json::Parser&, const std::string& str) {
+            json::allocator::Standard allocator;
+            json::Document lazy_document{allocator};
+            lazy_document.parse(str.data(), str.size());
+
+            auto root = lazy_document.root();
+            auto last = root[root.size() - 1];
+
+            for (const auto& field : {"id", "name", "timestamp"}) {
+                last[json::StringView{field, std::strlen(field)}].to_value();
+            }
+        });
+
+    std::cout << "  lazy:    " << lazy << " MB/s" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t size = DEFAULT_SIZE;
+
+    if (argc > 1) {
+        size = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    run("Records", generate_records(size * MEGABYTE));
+    run("Logs", generate_logs(size * MEGABYTE));
+    run("Metrics", generate_metrics(size * MEGABYTE));
+    run("Dense", generate_dense(size * MEGABYTE));
+}
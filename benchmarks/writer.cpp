@@ -0,0 +1,126 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file writer.cpp
+ *
+ * @brief Writer throughput benchmark
+ */
+
+#include "json/parser.hpp"
+#include "json/writer.hpp"
+#include "json/sink/buffer.hpp"
+#include "json/allocator/standard.hpp"
+
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr std::size_t MEGABYTE{1024 * 1024};
+static constexpr std::size_t DEFAULT_SIZE{16};
+static constexpr unsigned ITERATIONS{5};
+
+static std::string generate_records(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "  {\"id\": " + number +
+            ", \"name\": \"item-" + number + "\\t\"" +
+            ", \"tags\": [\"alpha\", \"beta\", \"gamma\"]" +
+            ", \"active\": true, \"parent\": null}";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+static std::string generate_metrics(std::size_t size) {
+    std::string document{"["};
+
+    for (std::size_t id = 0; document.size() < size; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "  {\"timestamp\": 17000000" + number +
+            ", \"values\": [" + number + ".1234567891, -0.000" + number +
+            "25, 98765.43210" + number + ", 1.5e-" + std::to_string(id % 300) +
+            ", " + std::to_string(id * 7919) + "]}";
+    }
+
+    document += "]";
+
+    return document;
+}
+
+static void run(const char* name, const std::string& document) {
+    json::allocator::Standard allocator;
+    json::Parser parser{allocator};
+
+    parser.parse(document.data(), document.size());
+
+    double best = 0.0;
+    json::Size size = 0;
+
+    for (unsigned i = 0; i < ITERATIONS; ++i) {
+        json::sink::Buffer buffer{allocator};
+        json::Writer writer{buffer};
+
+        auto start = Clock::now();
+        writer.write(parser.value());
+        writer.flush();
+        auto stop = Clock::now();
+
+        std::chrono::duration<double> elapsed = stop - start;
+        auto throughput = double(buffer.size()) / double(MEGABYTE) /
+            elapsed.count();
+
+        if (throughput > best) {
+            best = throughput;
+        }
+
+        size = buffer.size();
+    }
+
+    std::cout << name << ": " << size << " bytes" << std::endl;
+    std::cout << "  write(): " << best << " MB/s" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::size_t size = DEFAULT_SIZE;
+
+    if (argc > 1) {
+        size = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    run("Records", generate_records(size * MEGABYTE));
+    run("Metrics", generate_metrics(size * MEGABYTE));
+}
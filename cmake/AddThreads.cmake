@@ -17,7 +17,7 @@ if (THREADS)
     set(THREADS_PREFER_PTHREAD_FLAG TRUE)
     find_package(Threads)
 
-    if (CMAKE_THREAD_LIBS_INIT)
+    if (Threads_FOUND)
         set(CMAKE_EXE_LINKER_FLAGS
             "${CMAKE_EXE_LINKER_FLAGS} ${CMAKE_THREAD_LIBS_INIT}")
         message(STATUS "Threads enabled")
@@ -0,0 +1,73 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/allocator/arena.hpp
+ *
+ * @brief Interface
+ *
+ * Bump allocator for a single thread. Memory is released all at once
+ * with clear(), only the most recent allocation can be freed or grown
+ * in place.
+ */
+
+#ifndef JSON_ALLOCATOR_ARENA_HPP
+#define JSON_ALLOCATOR_ARENA_HPP
+
+#include "json/allocator.hpp"
+
+namespace json {
+namespace allocator {
+
+class Arena final : public Allocator {
+public:
+    static constexpr Size DEFAULT_SIZE{65536};
+
+    Arena() noexcept = default;
+
+    Arena(Size chunk_size) noexcept;
+
+    virtual void* allocate(Size size) noexcept override;
+
+    virtual void* reallocate(void* ptr, Size size) noexcept override;
+
+    virtual void deallocate(void* ptr) noexcept override;
+
+    virtual Size size(const void* ptr) const noexcept override;
+
+    void clear() noexcept;
+
+    virtual ~Arena() noexcept override;
+private:
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* m_chunk_last{nullptr};
+    void* m_allocated_last{nullptr};
+    Size m_chunk_size{DEFAULT_SIZE};
+};
+
+inline
+Arena::Arena(Size chunk_size) noexcept :
+    m_chunk_size{chunk_size}
+{ }
+
+}
+}
+
+#endif /* JSON_ALLOCATOR_ARENA_HPP */
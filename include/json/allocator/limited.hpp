@@ -0,0 +1,82 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/allocator/limited.hpp
+ *
+ * @brief Interface
+ *
+ * Decorator that caps the total size of live allocations made through
+ * another allocator. Requests above the cap fail like an exhausted heap,
+ * a parser then stops with ParseError::OUT_OF_MEMORY. Every allocation
+ * carries a small header with its size. Not thread safe.
+ */
+
+#ifndef JSON_ALLOCATOR_LIMITED_HPP
+#define JSON_ALLOCATOR_LIMITED_HPP
+
+#include "json/allocator.hpp"
+
+namespace json {
+namespace allocator {
+
+class Limited final : public Allocator {
+public:
+    Limited(Allocator& allocator, Size limit) noexcept;
+
+    virtual void* allocate(Size size) noexcept override;
+
+    virtual void* reallocate(void* ptr, Size size) noexcept override;
+
+    virtual void deallocate(void* ptr) noexcept override;
+
+    virtual Size size(const void* ptr) const noexcept override;
+
+    Size allocated() const noexcept;
+
+    Size limit() const noexcept;
+
+    virtual ~Limited() noexcept override;
+private:
+    Limited(const Limited&) = delete;
+    Limited& operator=(const Limited&) = delete;
+
+    Allocator* m_allocator;
+    Size m_limit;
+    Size m_allocated{0};
+};
+
+inline
+Limited::Limited(Allocator& allocator, Size limit) noexcept :
+    m_allocator{&allocator},
+    m_limit{limit}
+{ }
+
+inline auto
+Limited::allocated() const noexcept -> Size {
+    return m_allocated;
+}
+
+inline auto
+Limited::limit() const noexcept -> Size {
+    return m_limit;
+}
+
+}
+}
+
+#endif /* JSON_ALLOCATOR_LIMITED_HPP */
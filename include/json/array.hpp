@@ -92,6 +92,8 @@ public:
 
     void pop_back() noexcept;
 
+    void splice(Array&& other) noexcept;
+
     void clear() noexcept;
 
     size_type size() const noexcept;
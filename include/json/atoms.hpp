@@ -0,0 +1,103 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/atoms.hpp
+ *
+ * @brief Key interning interface
+ *
+ * Atoms is a hash-consed table of strings. Equal strings interned in the
+ * same table share one copy, so comparing the data() pointers of two
+ * atoms compares their contents. A Parser given an Atoms table stores
+ * object keys as borrowed Strings referring to atoms, repeated keys cost
+ * no allocation. The table must outlive every value referring to it and
+ * it isn't thread safe.
+ */
+
+#ifndef JSON_ATOMS_HPP
+#define JSON_ATOMS_HPP
+
+#include "types.hpp"
+#include "allocator.hpp"
+#include "string_view.hpp"
+
+#include <cstdint>
+
+namespace json {
+
+class Atoms {
+public:
+    Atoms() noexcept;
+
+    explicit Atoms(Allocator& alloc) noexcept;
+
+    /*! Returns the atom equal to str, an atom with null data on failure */
+    StringView intern(const StringView& str) noexcept;
+
+    /*! Returns the atom equal to str, an atom with null data if absent */
+    StringView find(const StringView& str) const noexcept;
+
+    Size size() const noexcept;
+
+    bool empty() const noexcept;
+
+    ~Atoms() noexcept;
+private:
+    static constexpr Size CAPACITY{64};
+
+    struct Atom {
+        Char* data;
+        Size size;
+        std::uint32_t hash;
+    };
+
+    Atom* lookup(const StringView& str, std::uint32_t hash) const noexcept;
+
+    bool grow() noexcept;
+
+    Atoms(const Atoms&) = delete;
+    Atoms& operator=(const Atoms&) = delete;
+
+    Allocator* m_allocator;
+    Atom* m_atoms{nullptr};
+    Size m_capacity{0};
+    Size m_size{0};
+};
+
+inline
+Atoms::Atoms() noexcept :
+    Atoms{Allocator::get_instance()}
+{ }
+
+inline
+Atoms::Atoms(Allocator& alloc) noexcept :
+    m_allocator{&alloc}
+{ }
+
+inline auto
+Atoms::size() const noexcept -> Size {
+    return m_size;
+}
+
+inline bool
+Atoms::empty() const noexcept {
+    return !m_size;
+}
+
+}
+
+#endif /* JSON_ATOMS_HPP */
@@ -0,0 +1,404 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/codec.hpp
+ *
+ * @brief Direct to struct decoding interface
+ *
+ * decode() reads a document with Reader straight into C++ objects, no
+ * Value is built. Codec<T>::decode() is called with the Reader on the
+ * first token of a value and leaves it on the last token of that value.
+ * Structures are described with JSON_FIELDS at global scope:
+ *
+ *     JSON_FIELDS(rpc::Request, id, method, params)
+ *
+ * Keys are dispatched with a switch over key_hash() values computed at
+ * compile time, colliding field names fail to compile as duplicated case
+ * labels. Unknown keys are skipped, missing fields are left untouched.
+ *
+ * Standard containers may throw while they grow, decoding then fails and
+ * the Reader reports OUT_OF_MEMORY.
+ */
+
+#ifndef JSON_CODEC_HPP
+#define JSON_CODEC_HPP
+
+#include "span.hpp"
+#include "hash.hpp"
+#include "types.hpp"
+#include "number.hpp"
+#include "reader.hpp"
+#include "allocator.hpp"
+#include "string_view.hpp"
+
+#include <map>
+#include <limits>
+#include <exception>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include <unordered_map>
+
+namespace json {
+
+template<Size N>
+bool key_equal(const StringView& str, const Char (&key)[N]) noexcept;
+
+template<typename F>
+bool guard_allocation(Reader& reader, F&& f) noexcept;
+
+template<typename T, typename Enable = void>
+struct Codec;
+
+template<typename T>
+bool decode(Reader& reader, T& value) noexcept;
+
+template<typename T>
+bool decode(const Char* data, Size size, T& value,
+        Allocator& alloc = Allocator::get_instance()) noexcept;
+
+template<typename T>
+bool decode(const Span<const Char>& data, T& value,
+        Allocator& alloc = Allocator::get_instance()) noexcept;
+
+/*! Base of JSON_FIELDS codecs, Codec<T>::field() decodes a single member */
+template<typename T>
+struct FieldsCodec {
+    static bool decode(Reader& reader, T& value) noexcept;
+};
+
+/*! Base of codecs for maps keyed by std::string */
+template<typename T>
+struct MapCodec {
+    static bool decode(Reader& reader, T& value) noexcept;
+};
+
+template<>
+struct Codec<Bool> {
+    static bool decode(Reader& reader, Bool& value) noexcept;
+};
+
+template<typename T>
+struct Codec<T, typename std::enable_if<std::is_integral<T>::value &&
+        std::is_signed<T>::value>::type> {
+    static bool decode(Reader& reader, T& value) noexcept;
+};
+
+template<typename T>
+struct Codec<T, typename std::enable_if<std::is_integral<T>::value &&
+        !std::is_signed<T>::value && !std::is_same<T, Bool>::value>::type> {
+    static bool decode(Reader& reader, T& value) noexcept;
+};
+
+template<typename T>
+struct Codec<T, typename std::enable_if<
+        std::is_floating_point<T>::value>::type> {
+    static bool decode(Reader& reader, T& value) noexcept;
+};
+
+template<>
+struct Codec<std::string> {
+    static bool decode(Reader& reader, std::string& value) noexcept;
+};
+
+template<typename T, typename A>
+struct Codec<std::vector<T, A>> {
+    static bool decode(Reader& reader, std::vector<T, A>& value) noexcept;
+};
+
+template<typename T, typename C, typename A>
+struct Codec<std::map<std::string, T, C, A>> :
+    MapCodec<std::map<std::string, T, C, A>> { };
+
+template<typename T, typename H, typename E, typename A>
+struct Codec<std::unordered_map<std::string, T, H, E, A>> :
+    MapCodec<std::unordered_map<std::string, T, H, E, A>> { };
+
+template<Size N> inline bool
+key_equal(const StringView& str, const Char (&key)[N]) noexcept {
+    return ((N - 1) == str.size()) &&
+        (0 == std::memcmp(str.data(), key, N - 1));
+}
+
+template<typename F> inline bool
+guard_allocation(Reader& reader, F&& f) noexcept {
+#if defined(__cpp_exceptions)
+    try {
+        f();
+    }
+    catch (const std::exception&) {
+        /* Standard containers only throw bad_alloc or length_error */
+        reader.fail(ParseError::OUT_OF_MEMORY);
+    }
+#else
+    f();
+#endif
+
+    return Status::ERROR != reader.status();
+}
+
+template<typename T> inline bool
+decode(Reader& reader, T& value) noexcept {
+    return Codec<T>::decode(reader, value);
+}
+
+template<typename T> inline bool
+decode(const Char* data, Size size, T& value, Allocator& alloc) noexcept {
+    Reader reader{data, size, alloc};
+
+    return reader.next() && Codec<T>::decode(reader, value) &&
+        !reader.next() && (Status::COMPLETE == reader.status());
+}
+
+template<typename T> inline bool
+decode(const Span<const Char>& data, T& value, Allocator& alloc) noexcept {
+    return decode(data.data(), data.size(), value, alloc);
+}
+
+template<typename T> bool
+FieldsCodec<T>::decode(Reader& reader, T& value) noexcept {
+    if (Reader::START_OBJECT != reader.token_type()) {
+        return false;
+    }
+
+    while (reader.next() && (Reader::KEY == reader.token_type())) {
+        if (!Codec<T>::field(reader, value)) {
+            return false;
+        }
+    }
+
+    return Reader::END_OBJECT == reader.token_type();
+}
+
+template<typename T> bool
+MapCodec<T>::decode(Reader& reader, T& value) noexcept {
+    if (Reader::START_OBJECT != reader.token_type()) {
+        return false;
+    }
+
+    value.clear();
+
+    while (reader.next() && (Reader::KEY == reader.token_type())) {
+        using Item = typename T::mapped_type;
+
+        auto key = reader.get_string_view();
+        Item* item = nullptr;
+
+        if (!guard_allocation(reader, [&value, &key, &item] () {
+                    item = &value[std::string{key.data(), key.size()}];
+                }) || !reader.next() || !Codec<Item>::decode(reader, *item)) {
+            return false;
+        }
+    }
+
+    return Reader::END_OBJECT == reader.token_type();
+}
+
+inline bool
+Codec<Bool>::decode(Reader& reader, Bool& value) noexcept {
+    if (Reader::BOOLEAN != reader.token_type()) {
+        return false;
+    }
+
+    value = reader.get_bool();
+    return true;
+}
+
+template<typename T> bool
+Codec<T, typename std::enable_if<std::is_integral<T>::value &&
+        std::is_signed<T>::value>::type>::decode(Reader& reader,
+        T& value) noexcept {
+    if (Reader::NUMBER != reader.token_type()) {
+        return false;
+    }
+
+    const auto& number = reader.get_number();
+
+    switch (number.type()) {
+    case Number::INT:
+        if ((Int(number) < Int(std::numeric_limits<T>::min())) ||
+                (Int(number) > Int(std::numeric_limits<T>::max()))) {
+            return false;
+        }
+        value = T(Int(number));
+        return true;
+    case Number::UINT:
+        if (Uint(number) > Uint(std::numeric_limits<T>::max())) {
+            return false;
+        }
+        value = T(Uint(number));
+        return true;
+    case Number::DOUBLE:
+    case Number::DECIMAL:
+    default:
+        return false;
+    }
+}
+
+template<typename T> bool
+Codec<T, typename std::enable_if<std::is_integral<T>::value &&
+        !std::is_signed<T>::value && !std::is_same<T, Bool>::value>::type>::
+decode(Reader& reader, T& value) noexcept {
+    if (Reader::NUMBER != reader.token_type()) {
+        return false;
+    }
+
+    const auto& number = reader.get_number();
+
+    if (Number::UINT != number.type()) {
+        return false;
+    }
+
+    if (Uint(number) > Uint(std::numeric_limits<T>::max())) {
+        return false;
+    }
+
+    value = T(Uint(number));
+    return true;
+}
+
+template<typename T> bool
+Codec<T, typename std::enable_if<std::is_floating_point<T>::value>::type>::
+decode(Reader& reader, T& value) noexcept {
+    if (Reader::NUMBER != reader.token_type()) {
+        return false;
+    }
+
+    value = T(Double(reader.get_number()));
+    return true;
+}
+
+inline bool
+Codec<std::string>::decode(Reader& reader, std::string& value) noexcept {
+    if (Reader::STRING != reader.token_type()) {
+        return false;
+    }
+
+    auto str = reader.get_string_view();
+
+    return guard_allocation(reader, [&value, &str] () {
+            value.assign(str.data(), str.size());
+        });
+}
+
+template<typename T, typename A> bool
+Codec<std::vector<T, A>>::decode(Reader& reader,
+        std::vector<T, A>& value) noexcept {
+    if (Reader::START_ARRAY != reader.token_type()) {
+        return false;
+    }
+
+    value.clear();
+
+    while (reader.next() && (Reader::END_ARRAY != reader.token_type())) {
+        T item{};
+
+        if (!Codec<T>::decode(reader, item) ||
+                !guard_allocation(reader, [&value, &item] () {
+                    value.push_back(std::move(item));
+                })) {
+            return false;
+        }
+    }
+
+    return Reader::END_ARRAY == reader.token_type();
+}
+
+}
+
+#define JSON_FIELDS_CAT(a, b) JSON_FIELDS_CAT_EXPAND(a, b)
+#define JSON_FIELDS_CAT_EXPAND(a, b) a ## b
+
+#define JSON_FIELDS_CASE(name) \
+    case json::key_hash(#name): \
+        if (json::key_equal(key, #name)) { \
+            return reader.next() && json::decode(reader, value.name); \
+        } \
+        break;
+
+#define JSON_FIELDS_EACH_1(f, x) f(x)
+#define JSON_FIELDS_EACH_2(f, x, ...) f(x) JSON_FIELDS_EACH_1(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_3(f, x, ...) f(x) JSON_FIELDS_EACH_2(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_4(f, x, ...) f(x) JSON_FIELDS_EACH_3(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_5(f, x, ...) f(x) JSON_FIELDS_EACH_4(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_6(f, x, ...) f(x) JSON_FIELDS_EACH_5(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_7(f, x, ...) f(x) JSON_FIELDS_EACH_6(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_8(f, x, ...) f(x) JSON_FIELDS_EACH_7(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_9(f, x, ...) f(x) JSON_FIELDS_EACH_8(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_10(f, x, ...) f(x) JSON_FIELDS_EACH_9(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_11(f, x, ...) f(x) JSON_FIELDS_EACH_10(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_12(f, x, ...) f(x) JSON_FIELDS_EACH_11(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_13(f, x, ...) f(x) JSON_FIELDS_EACH_12(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_14(f, x, ...) f(x) JSON_FIELDS_EACH_13(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_15(f, x, ...) f(x) JSON_FIELDS_EACH_14(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_16(f, x, ...) f(x) JSON_FIELDS_EACH_15(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_17(f, x, ...) f(x) JSON_FIELDS_EACH_16(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_18(f, x, ...) f(x) JSON_FIELDS_EACH_17(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_19(f, x, ...) f(x) JSON_FIELDS_EACH_18(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_20(f, x, ...) f(x) JSON_FIELDS_EACH_19(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_21(f, x, ...) f(x) JSON_FIELDS_EACH_20(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_22(f, x, ...) f(x) JSON_FIELDS_EACH_21(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_23(f, x, ...) f(x) JSON_FIELDS_EACH_22(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_24(f, x, ...) f(x) JSON_FIELDS_EACH_23(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_25(f, x, ...) f(x) JSON_FIELDS_EACH_24(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_26(f, x, ...) f(x) JSON_FIELDS_EACH_25(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_27(f, x, ...) f(x) JSON_FIELDS_EACH_26(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_28(f, x, ...) f(x) JSON_FIELDS_EACH_27(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_29(f, x, ...) f(x) JSON_FIELDS_EACH_28(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_30(f, x, ...) f(x) JSON_FIELDS_EACH_29(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_31(f, x, ...) f(x) JSON_FIELDS_EACH_30(f, __VA_ARGS__)
+#define JSON_FIELDS_EACH_32(f, x, ...) f(x) JSON_FIELDS_EACH_31(f, __VA_ARGS__)
+
+#define JSON_FIELDS_COUNT(...) JSON_FIELDS_COUNT_N(__VA_ARGS__, \
+    32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, \
+    21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, \
+    10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+#define JSON_FIELDS_COUNT_N( \
+    _1, _2, _3, _4, _5, _6, _7, _8, \
+    _9, _10, _11, _12, _13, _14, _15, _16, \
+    _17, _18, _19, _20, _21, _22, _23, _24, \
+    _25, _26, _27, _28, _29, _30, _31, _32, \
+    n, ...) n
+
+#define JSON_FIELDS_EACH(f, ...) \
+    JSON_FIELDS_CAT(JSON_FIELDS_EACH_, \
+            JSON_FIELDS_COUNT(__VA_ARGS__))(f, __VA_ARGS__)
+
+/*! Defines json::Codec for a structure with the listed public members */
+#define JSON_FIELDS(type, ...) \
+    namespace json { \
+    template<> \
+    struct Codec<type> : FieldsCodec<type> { \
+        static bool field(Reader& reader, type& value) noexcept { \
+            auto key = reader.get_string_view(); \
+            switch (key_hash(key)) { \
+            JSON_FIELDS_EACH(JSON_FIELDS_CASE, __VA_ARGS__) \
+            default: \
+                break; \
+            } \
+            reader.skip_value(); \
+            return true; \
+        } \
+    }; \
+    }
+
+#endif /* JSON_CODEC_HPP */
@@ -0,0 +1,236 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/document.hpp
+ *
+ * @brief On demand JSON document
+ *
+ * Document indexes positions of structural characters and quotes of
+ * a buffer together with matching brackets. Values are parsed only when
+ * they are accessed through LazyValue, other subtrees are jumped over.
+ * The buffer must outlive the document.
+ *
+ * Indexing checks brackets, quotes, commas and colons and that values are
+ * separated by them. Scalar text itself is checked only once it is read,
+ * so [tru] is COMPLETE and get() of its element returns false.
+ */
+
+#ifndef JSON_DOCUMENT_HPP
+#define JSON_DOCUMENT_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "value.hpp"
+#include "number.hpp"
+#include "string.hpp"
+#include "parser.hpp"
+#include "allocator.hpp"
+#include "string_view.hpp"
+
+namespace json {
+
+class Document;
+
+class LazyValue {
+public:
+    LazyValue() noexcept = default;
+
+    bool is_valid() const noexcept;
+
+    Value::Type type() const noexcept;
+
+    bool is_null() const noexcept;
+
+    bool is_bool() const noexcept;
+
+    bool is_number() const noexcept;
+
+    bool is_string() const noexcept;
+
+    bool is_array() const noexcept;
+
+    bool is_object() const noexcept;
+
+    /*!
+     * Parses the value, false when it is of another type or malformed.
+     * Scalars aren't checked while indexing, only here.
+     */
+    bool get(Bool& value) const noexcept;
+
+    bool get(Number& value) const noexcept;
+
+    bool get(String& value) const noexcept;
+
+    /*!
+     * Same as get() with a default value, false, zero or an empty string,
+     * for a value that can't be read
+     */
+    Bool as_bool() const noexcept;
+
+    Number as_number() const noexcept;
+
+    String as_string() const noexcept;
+
+    Value to_value() const noexcept;
+
+    StringView raw() const noexcept;
+
+    Size size() const noexcept;
+
+    LazyValue operator[](Size index) const noexcept;
+
+    template<Size N>
+    LazyValue operator[](const Char (&key)[N]) const noexcept;
+
+    LazyValue operator[](const StringView& key) const noexcept;
+private:
+    friend class Document;
+
+    LazyValue(const Document& document, Size begin, Size entry) noexcept;
+
+    LazyValue element(Size entry) const noexcept;
+
+    Size next() const noexcept;
+
+    Size end() const noexcept;
+
+    Allocator& allocator() const noexcept;
+
+    const Document* m_document{nullptr};
+    Size m_begin{0};
+    Size m_entry{0};
+};
+
+class Document {
+public:
+    Document() noexcept;
+
+    explicit Document(Allocator& alloc) noexcept;
+
+    Status parse(const Char* data, Size size) noexcept;
+
+    Status parse(const Span<const Char>& data) noexcept;
+
+    Status status() const noexcept;
+
+    LazyValue root() const noexcept;
+
+    Allocator& allocator() const noexcept;
+
+    ~Document() noexcept;
+private:
+    friend class LazyValue;
+
+    struct Entry {
+        Size position;
+        Size match;
+    };
+
+    bool push(Size position) noexcept;
+
+    Size skip_whitespace(Size position) const noexcept;
+
+    Document(const Document&) = delete;
+    Document& operator=(const Document&) = delete;
+
+    Allocator* m_allocator;
+    const Char* m_data{nullptr};
+    Size m_size{0};
+    Entry* m_entries{nullptr};
+    Size m_entries_size{0};
+    Size m_entries_length{0};
+    Status m_status{Status::NEED_MORE};
+};
+
+inline
+LazyValue::LazyValue(const Document& document, Size begin,
+        Size entry) noexcept :
+    m_document{&document},
+    m_begin{begin},
+    m_entry{entry}
+{ }
+
+inline auto
+LazyValue::is_valid() const noexcept -> bool {
+    return nullptr != m_document;
+}
+
+inline auto
+LazyValue::is_null() const noexcept -> bool {
+    return is_valid() && (Value::NIL == type());
+}
+
+inline auto
+LazyValue::is_bool() const noexcept -> bool {
+    return Value::BOOLEAN == type();
+}
+
+inline auto
+LazyValue::is_number() const noexcept -> bool {
+    return Value::NUMBER == type();
+}
+
+inline auto
+LazyValue::is_string() const noexcept -> bool {
+    return Value::STRING == type();
+}
+
+inline auto
+LazyValue::is_array() const noexcept -> bool {
+    return Value::ARRAY == type();
+}
+
+inline auto
+LazyValue::is_object() const noexcept -> bool {
+    return Value::OBJECT == type();
+}
+
+template<Size N> inline auto
+LazyValue::operator[](const Char (&key)[N]) const noexcept -> LazyValue {
+    return operator[](StringView{key, N - 1});
+}
+
+inline
+Document::Document() noexcept :
+    Document{Allocator::get_instance()}
+{ }
+
+inline
+Document::Document(Allocator& alloc) noexcept :
+    m_allocator{&alloc}
+{ }
+
+inline auto
+Document::parse(const Span<const Char>& data) noexcept -> Status {
+    return parse(data.data(), data.size());
+}
+
+inline auto
+Document::status() const noexcept -> Status {
+    return m_status;
+}
+
+inline auto
+Document::allocator() const noexcept -> Allocator& {
+    return *m_allocator;
+}
+
+}
+
+#endif /* JSON_DOCUMENT_HPP */
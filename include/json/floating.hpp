@@ -0,0 +1,106 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/floating.hpp
+ *
+ * @brief Decimal number conversion
+ *
+ * Correctly rounded conversion of decimal numbers to IEEE 754 doubles.
+ * Numbers are first tried with the Clinger fast path, then with the
+ * Eisel-Lemire algorithm. Rare cases that both can't decide are handled
+ * by a slow, exact conversion of the complete decimal text. Digit runs
+ * are converted 8 at a time with SWAR arithmetic.
+ *
+ * Doubles are formatted back with the Schubfach algorithm, the shortest
+ * digits that still read back as the same double. Digits are written two
+ * at a time from a table, no printf and no locale.
+ */
+
+#ifndef JSON_FLOATING_HPP
+#define JSON_FLOATING_HPP
+
+#include "types.hpp"
+
+#include <cstdint>
+
+namespace json {
+namespace floating {
+
+/*!
+ * Converts significand * 10^exponent. Truncated significand holds only
+ * leading digits of a longer number. Returns false when result can't be
+ * determined without all digits.
+ */
+bool compute(Uint significand, Int exponent, bool truncated,
+        bool negative, Double& value) noexcept;
+
+/*!
+ * Converts complete JSON number text, any length, always exact
+ */
+Double compute(const Char* data, Size size) noexcept;
+
+static constexpr Size FORMAT_SIZE{25};
+
+/*!
+ * Writes the shortest text of a finite value, integral values end with
+ * ".0". Output must hold FORMAT_SIZE characters, returns written length.
+ */
+Size format(Double value, Char* output) noexcept;
+
+/*!
+ * Writes decimal digits of value, returns written length
+ */
+Size format(Uint value, Char* output) noexcept;
+
+static constexpr Size DIGITS_SIZE{8};
+
+/*!
+ * Little-endian load, first character lands in the lowest byte
+ */
+static inline std::uint64_t load_digits(const Char* data) noexcept {
+    std::uint64_t value = 0;
+
+    for (unsigned i = 0; i < DIGITS_SIZE; ++i) {
+        value |= std::uint64_t(std::uint8_t(data[i])) << (8 * i);
+    }
+
+    return value;
+}
+
+static inline bool is_eight_digits(std::uint64_t value) noexcept {
+    return 0 == (((value & 0xF0F0F0F0F0F0F0F0) |
+        (((value + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ^
+        0x3333333333333333);
+}
+
+/*!
+ * Converts pairs of digits, then quadruples, then both halves
+ */
+static inline std::uint64_t eight_digits(std::uint64_t value) noexcept {
+    value -= 0x3030303030303030;
+    value = (value * 10) + (value >> 8);
+    value = (((value & 0x000000FF000000FF) * 0x000F424000000064) +
+        (((value >> 16) & 0x000000FF000000FF) * 0x0000271000000001)) >> 32;
+    return value & 0xFFFFFFFF;
+}
+
+}
+}
+
+#endif /* JSON_FLOATING_HPP */
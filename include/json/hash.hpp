@@ -0,0 +1,62 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/hash.hpp
+ *
+ * @brief Key hashing interface
+ */
+
+#ifndef JSON_HASH_HPP
+#define JSON_HASH_HPP
+
+#include "types.hpp"
+#include "string_view.hpp"
+
+#include <cstdint>
+
+namespace json {
+
+/*! FNV-1a hash of a key */
+constexpr std::uint32_t key_hash(const Char* str, Size size,
+        std::uint32_t value = 2166136261u) noexcept {
+    return size ? key_hash(str + 1, size - 1,
+            (value ^ std::uint8_t(*str)) * 16777619u) : value;
+}
+
+template<Size N>
+constexpr std::uint32_t key_hash(const Char (&str)[N]) noexcept {
+    return key_hash(str, N - 1);
+}
+
+std::uint32_t key_hash(const StringView& str) noexcept;
+
+inline auto
+key_hash(const StringView& str) noexcept -> std::uint32_t {
+    std::uint32_t value = 2166136261u;
+
+    for (auto ch : str) {
+        value = (value ^ std::uint8_t(ch)) * 16777619u;
+    }
+
+    return value;
+}
+
+}
+
+#endif /* JSON_HASH_HPP */
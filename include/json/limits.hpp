@@ -0,0 +1,56 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/limits.hpp
+ *
+ * @brief Parser resource limits
+ *
+ * Limits are checked while parsing and the parser fails with a
+ * ParseError::*_LIMIT code as soon as one is exceeded. The document size
+ * is checked before any byte of an oversized parse() call is looked at.
+ * Total memory is capped with allocator::Limited.
+ */
+
+#ifndef JSON_LIMITS_HPP
+#define JSON_LIMITS_HPP
+
+#include "types.hpp"
+
+#include <limits>
+
+namespace json {
+
+struct Limits {
+    static constexpr Size NO_LIMIT{std::numeric_limits<Size>::max()};
+
+    /*! Levels of nested arrays and objects */
+    Size depth{NO_LIMIT};
+
+    /*! Bytes of a single string or key after unescaping */
+    Size string_length{NO_LIMIT};
+
+    /*! Members of a single object */
+    Size members{NO_LIMIT};
+
+    /*! Bytes of input */
+    Size document_size{NO_LIMIT};
+};
+
+}
+
+#endif /* JSON_LIMITS_HPP */
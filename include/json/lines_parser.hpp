@@ -0,0 +1,99 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/lines_parser.hpp
+ *
+ * @brief Newline delimited JSON parser interface
+ *
+ * LinesParser splits a buffer with one JSON document per line into
+ * batches of lines and parses them on a pool of threads. Every thread
+ * builds values from its own arena allocator. Records are identified by
+ * byte offsets of their lines, values are valid only during the observer
+ * call. In the ORDERED mode records are reported one at a time in input
+ * order, in the UNORDERED mode they are reported concurrently as soon as
+ * they are parsed.
+ */
+
+#ifndef JSON_LINES_PARSER_HPP
+#define JSON_LINES_PARSER_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "value.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+
+namespace json {
+
+class LinesParser {
+public:
+    enum Order {
+        ORDERED,
+        UNORDERED
+    };
+
+    class Observer {
+    public:
+        virtual void record_parsed(Size offset, Value& value) noexcept = 0;
+
+        virtual void record_parsed(Size offset,
+                Size error_offset) noexcept = 0;
+
+        virtual ~Observer() noexcept;
+    };
+
+    static constexpr Size BATCH_SIZE{1048576};
+
+    LinesParser(Observer& observer, Order order = ORDERED,
+            Size threads = 0, Size batch_size = BATCH_SIZE) noexcept;
+
+    void parse(const Char* data, Size size) noexcept;
+
+    void parse(const Span<const Char>& data) noexcept;
+private:
+    void work() noexcept;
+
+    void parse(Size batch) noexcept;
+
+    LinesParser(const LinesParser&) = delete;
+    LinesParser& operator=(const LinesParser&) = delete;
+
+    std::reference_wrapper<Observer> m_observer;
+    Order m_order;
+    Size m_threads;
+    Size m_batch_size;
+    const Char* m_data{nullptr};
+    Size m_size{0};
+    std::atomic<Size> m_batch{0};
+    std::mutex m_mutex{};
+    std::condition_variable m_delivered{};
+    Size m_delivered_batch{0};
+};
+
+inline void
+LinesParser::parse(const Span<const Char>& data) noexcept {
+    parse(data.data(), data.size());
+}
+
+}
+
+#endif /* JSON_LINES_PARSER_HPP */
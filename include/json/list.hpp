@@ -55,6 +55,8 @@ public:
 
     void assign(List&& other) noexcept;
 
+    void splice(List&& other) noexcept;
+
     bool empty() const noexcept;
 
     void clear() noexcept;
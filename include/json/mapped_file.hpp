@@ -0,0 +1,138 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/mapped_file.hpp
+ *
+ * @brief Memory mapped file interface
+ *
+ * MappedFile maps a whole file into memory as a private, writable and
+ * copy on write mapping. Only pages that are written are copied, so
+ * in situ parsing of a mapped file keeps strings inside the mapping with
+ * almost no extra resident memory. Values with borrowed strings are
+ * valid as long as the mapped file. Platforms without mmap read the file
+ * into an allocated buffer instead.
+ */
+
+#ifndef JSON_MAPPED_FILE_HPP
+#define JSON_MAPPED_FILE_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "parser.hpp"
+
+namespace json {
+
+class MappedFile {
+public:
+    MappedFile() noexcept = default;
+
+    explicit MappedFile(const char* path) noexcept;
+
+    MappedFile(MappedFile&& other) noexcept;
+
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool open(const char* path) noexcept;
+
+    void close() noexcept;
+
+    bool is_open() const noexcept;
+
+    Char* data() noexcept;
+
+    const Char* data() const noexcept;
+
+    Size size() const noexcept;
+
+    Span<const Char> span() const noexcept;
+
+    ~MappedFile() noexcept;
+private:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    Char* m_data{nullptr};
+    Size m_size{0};
+    bool m_is_open{false};
+};
+
+/*!
+ * Parses a file. The file is unmapped on return, so strings are copied
+ * instead of parsed in situ, in situ strings would point into the gone
+ * mapping. Files that can't be opened or mapped fail the parser with
+ * ParseError::FILE_ERROR, empty files end with ParseError::UNEXPECTED_END
+ * like any other empty input.
+ */
+Status parse_file(const char* path, Parser& parser) noexcept;
+
+/*!
+ * Parses a mapped file in situ, strings borrow the mapped memory. Closed
+ * files fail the parser with ParseError::FILE_ERROR.
+ */
+Status parse_file(MappedFile& file, Parser& parser) noexcept;
+
+inline
+MappedFile::MappedFile(const char* path) noexcept {
+    open(path);
+}
+
+inline
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    m_data{other.m_data},
+    m_size{other.m_size},
+    m_is_open{other.m_is_open}
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_is_open = false;
+}
+
+inline auto
+MappedFile::is_open() const noexcept -> bool {
+    return m_is_open;
+}
+
+inline auto
+MappedFile::data() noexcept -> Char* {
+    return m_data;
+}
+
+inline auto
+MappedFile::data() const noexcept -> const Char* {
+    return m_data;
+}
+
+inline auto
+MappedFile::size() const noexcept -> Size {
+    return m_size;
+}
+
+inline auto
+MappedFile::span() const noexcept -> Span<const Char> {
+    return {m_data, m_size};
+}
+
+inline
+MappedFile::~MappedFile() noexcept {
+    close();
+}
+
+}
+
+#endif /* JSON_MAPPED_FILE_HPP */
@@ -26,7 +26,10 @@
 #define JSON_NUMBER_HPP
 
 #include "types.hpp"
+#include "allocator.hpp"
+#include "string_view.hpp"
 
+#include <cstdint>
 #include <type_traits>
 
 namespace json {
@@ -51,13 +54,37 @@ public:
     enum Type {
         INT,
         UINT,
-        DOUBLE
+        DOUBLE,
+        DECIMAL
     };
 
     Number() noexcept = default;
 
     Number(Type value) noexcept;
 
+    /*!
+     * Raw number keeps only a reference to its JSON text and the type it
+     * converts to, conversion is done on every access
+     */
+    Number(Type hint, const Char* data, Size size) noexcept;
+
+    /*!
+     * Decimal of JSON number text, exact at any precision. Large decimals
+     * are allocated, decimals that can't be stored fall back to Double
+     */
+    explicit Number(const StringView& text,
+            Allocator& alloc = Allocator::get_instance()) noexcept;
+
+    Number(const Number& other) noexcept;
+
+    Number(Number&& other) noexcept;
+
+    Number& operator=(const Number& other) noexcept;
+
+    Number& operator=(Number&& other) noexcept;
+
+    ~Number() noexcept;
+
     template<typename T, enable_int<T> = 0>
     Number(T value) noexcept;
 
@@ -127,17 +154,190 @@ public:
 
     bool is_floating_point() const noexcept;
 
+    bool is_decimal() const noexcept;
+
     Type type() const noexcept;
+
+    bool is_raw() const noexcept;
+
+    /*! Text of a raw number, empty otherwise */
+    StringView raw() const noexcept;
+
+    /*! Raw number converted to its type, other numbers are copied */
+    Number converted(
+            Allocator& alloc = Allocator::get_instance()) const noexcept;
+
+    /*!
+     * Writes a decimal as JSON number text and returns its length.
+     * Nothing is written when the buffer is too small
+     */
+    Size decimal_text(Char* buffer, Size size) const noexcept;
 private:
+    using Limb = std::uint32_t;
+
+    static constexpr Size INLINE_LIMBS{4};
+
+    struct Raw {
+        const Char* data;
+        Size size;
+    };
+
+    struct Heap {
+        Allocator* allocator;
+        Limb* limbs;
+    };
+
+    /* Value is limbs of 9 digits, least significant first, times
+     * 10 to the exponent */
+    struct Decimal {
+        std::int32_t exponent;
+        std::uint16_t size;
+        bool is_negative;
+        union {
+            Limb digits[INLINE_LIMBS];
+            Heap heap;
+        };
+    };
+
+    static Number decimal(Allocator& alloc, const Limb* limbs, Size size,
+            Int exponent, bool is_negative) noexcept;
+
+    static int compare(const Number& lhs, const Number& rhs) noexcept;
+
+    static Number add(const Number& lhs, const Number& rhs,
+            bool is_subtraction) noexcept;
+
+    static Number multiply(const Number& lhs, const Number& rhs) noexcept;
+
+    Number decimal() const noexcept;
+
+    const Limb* limbs() const noexcept;
+
+    Allocator* allocator() const noexcept;
+
+    Size digits(Char* buffer) const noexcept;
+
+    Double to_double() const noexcept;
+
+    Uint to_uint() const noexcept;
+
+    bool is_heap() const noexcept;
+
+    void copy(const Number& other) noexcept;
+
+    void copy_heap(const Number& other) noexcept;
+
+    void take(Number& other) noexcept;
+
+    void release() noexcept;
+
     Type m_type{INT};
+    bool m_is_raw{false};
 
     union {
         Int m_int{0};
         Uint m_uint;
         Double m_double;
+        Raw m_raw;
+        Decimal m_decimal;
     };
 };
 
+inline
+Number::Number(Type hint, const Char* data, Size size) noexcept :
+    m_type{hint},
+    m_is_raw{true},
+    m_raw{data, size}
+{ }
+
+inline
+Number::Number(const Number& other) noexcept :
+    Number{}
+{
+    copy(other);
+}
+
+inline
+Number::Number(Number&& other) noexcept :
+    Number{}
+{
+    take(other);
+}
+
+inline auto
+Number::operator=(const Number& other) noexcept -> Number& {
+    if (this != &other) {
+        if (is_heap()) {
+            release();
+        }
+        copy(other);
+    }
+    return *this;
+}
+
+inline auto
+Number::operator=(Number&& other) noexcept -> Number& {
+    if (this != &other) {
+        if (is_heap()) {
+            release();
+        }
+        take(other);
+    }
+    return *this;
+}
+
+inline bool
+Number::is_heap() const noexcept {
+    return !m_is_raw && (DECIMAL == m_type) &&
+        (m_decimal.size > INLINE_LIMBS);
+}
+
+inline void
+Number::copy(const Number& other) noexcept {
+    m_type = other.m_type;
+    m_is_raw = other.m_is_raw;
+
+    if (m_is_raw) {
+        m_raw = other.m_raw;
+        return;
+    }
+
+    switch (m_type) {
+    case INT:
+        m_int = other.m_int;
+        break;
+    case UINT:
+        m_uint = other.m_uint;
+        break;
+    case DOUBLE:
+        m_double = other.m_double;
+        break;
+    case DECIMAL:
+        m_decimal = other.m_decimal;
+        if (is_heap()) {
+            copy_heap(other);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+inline void
+Number::take(Number& other) noexcept {
+    /* Limbs are taken over instead of copied */
+    if (other.is_heap()) {
+        m_type = DECIMAL;
+        m_is_raw = false;
+        m_decimal = other.m_decimal;
+        other.m_type = INT;
+        other.m_int = 0;
+    }
+    else {
+        copy(other);
+    }
+}
+
 template<typename T, Number::enable_int<T>> inline
 Number::Number(T value) noexcept :
     m_type{INT},
@@ -181,9 +381,19 @@ Number::type() const noexcept -> Type {
     return m_type;
 }
 
+inline bool
+Number::is_raw() const noexcept {
+    return m_is_raw;
+}
+
+inline auto
+Number::raw() const noexcept -> StringView {
+    return m_is_raw ? StringView{m_raw.data, m_raw.size} : StringView{nullptr};
+}
+
 inline bool
 Number::is_signed() const noexcept {
-    return (INT == type()) || (DOUBLE == type());
+    return (INT == type()) || (DOUBLE == type()) || (DECIMAL == type());
 }
 
 inline bool
@@ -201,6 +411,11 @@ Number::is_floating_point() const noexcept {
     return (DOUBLE == type());
 }
 
+inline bool
+Number::is_decimal() const noexcept {
+    return (DECIMAL == type());
+}
+
 inline
 Number::operator bool() const noexcept {
     return !!*this;
@@ -0,0 +1,107 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/parallel_parser.hpp
+ *
+ * @brief Parallel parser interface for a top-level array
+ *
+ * A structural pass finds commas that separate items of a top-level
+ * array and splits the document into ranges of whole items. Every range
+ * is parsed on its own thread and the partial arrays are spliced into
+ * one without copying items. Other documents and documents smaller than
+ * two ranges are parsed in place.
+ *
+ * By default every thread allocates from its own arena owned by the
+ * parser, threads never wait for each other. Values are then valid until
+ * the next parse() or the end of the parser. A given allocator is shared
+ * by all threads and must be thread safe.
+ */
+
+#ifndef JSON_PARALLEL_PARSER_HPP
+#define JSON_PARALLEL_PARSER_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "value.hpp"
+#include "parser.hpp"
+#include "allocator.hpp"
+#include "allocator/arena.hpp"
+
+#include <memory>
+
+namespace json {
+
+class ParallelParser {
+public:
+    static constexpr Size RANGE_SIZE{16777216};
+
+    explicit ParallelParser(Size threads = 0,
+            Size range_size = RANGE_SIZE) noexcept;
+
+    explicit ParallelParser(Allocator& alloc, Size threads = 0,
+            Size range_size = RANGE_SIZE) noexcept;
+
+    Status parse(const Char* data, Size size) noexcept;
+
+    Status parse(const Span<const Char>& data) noexcept;
+
+    Size offset() const noexcept;
+
+    Value& value() noexcept;
+
+    const Value& value() const noexcept;
+
+    ~ParallelParser() noexcept;
+private:
+    ParallelParser(const ParallelParser&) = delete;
+    ParallelParser& operator=(const ParallelParser&) = delete;
+
+    Allocator& allocator(Size thread) noexcept;
+
+    Allocator* m_allocator;
+    Size m_threads;
+    Size m_range_size;
+    Size m_offset{0};
+    std::unique_ptr<allocator::Arena[]> m_arenas{};
+    Value m_value;
+};
+
+inline auto
+ParallelParser::parse(const Span<const Char>& data) noexcept -> Status {
+    return parse(data.data(), data.size());
+}
+
+inline auto
+ParallelParser::offset() const noexcept -> Size {
+    return m_offset;
+}
+
+inline auto
+ParallelParser::value() noexcept -> Value& {
+    return m_value;
+}
+
+inline auto
+ParallelParser::value() const noexcept -> const Value& {
+    return m_value;
+}
+
+}
+
+#endif /* JSON_PARALLEL_PARSER_HPP */
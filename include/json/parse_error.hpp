@@ -0,0 +1,126 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/parse_error.hpp
+ *
+ * @brief Parse error interface
+ */
+
+#ifndef JSON_PARSE_ERROR_HPP
+#define JSON_PARSE_ERROR_HPP
+
+#include "types.hpp"
+
+#include <cstdint>
+
+namespace json {
+
+/*!
+ * Why and where parsing failed. Offset counts bytes from the beginning of
+ * the input, line and column count from 1 and column counts bytes
+ */
+class ParseError {
+public:
+    enum Code : std::uint8_t {
+        NONE,
+        UNEXPECTED_CHARACTER,
+        UNEXPECTED_END,
+        TRAILING_CHARACTERS,
+        INVALID_LITERAL,
+        INVALID_NUMBER,
+        CONTROL_CHARACTER,
+        INVALID_ESCAPE,
+        INVALID_UNICODE_ESCAPE,
+        INVALID_UTF8,
+        MISMATCHED_BRACKET,
+        HANDLER_REJECTED,
+        OUT_OF_MEMORY,
+        DEPTH_LIMIT,
+        STRING_LIMIT,
+        MEMBERS_LIMIT,
+        DOCUMENT_LIMIT,
+        FILE_ERROR
+    };
+
+    static const char* message(Code code) noexcept;
+
+    ParseError() noexcept = default;
+
+    ParseError(Code code, Size offset, Size line, Size column) noexcept;
+
+    /*! True when there is an error */
+    explicit operator bool() const noexcept;
+
+    Code code() const noexcept;
+
+    const char* message() const noexcept;
+
+    Size offset() const noexcept;
+
+    Size line() const noexcept;
+
+    Size column() const noexcept;
+private:
+    Code m_code{NONE};
+    Size m_offset{0};
+    Size m_line{0};
+    Size m_column{0};
+};
+
+inline
+ParseError::ParseError(Code code, Size offset, Size line,
+        Size column) noexcept :
+    m_code{code},
+    m_offset{offset},
+    m_line{line},
+    m_column{column}
+{ }
+
+inline
+ParseError::operator bool() const noexcept {
+    return NONE != m_code;
+}
+
+inline auto
+ParseError::code() const noexcept -> Code {
+    return m_code;
+}
+
+inline auto
+ParseError::message() const noexcept -> const char* {
+    return message(m_code);
+}
+
+inline auto
+ParseError::offset() const noexcept -> Size {
+    return m_offset;
+}
+
+inline auto
+ParseError::line() const noexcept -> Size {
+    return m_line;
+}
+
+inline auto
+ParseError::column() const noexcept -> Size {
+    return m_column;
+}
+
+}
+
+#endif /* JSON_PARSE_ERROR_HPP */
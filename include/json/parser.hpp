@@ -20,98 +20,1929 @@
  * @file json/parser.hpp
  *
  * @brief JSON parser interface
+ *
+ * BasicParser is an event driven parser. It reports parsed values to
+ * a handler given as a template parameter, handler methods are called
+ * directly and can be inlined. Handlers derive from Handler, it provides
+ * defaults for events that a handler doesn't care about. Parser builds
+ * a Value tree on top of it.
+ *
+ * A handler may call skip_value() from key(), start_object() or
+ * start_array(). The value of that member or the rest of that container
+ * is then jumped over by bracket and quote matching, no events are
+ * reported for it, including the closing end_object() or end_array().
+ * A handler may also call suspend(), parse() then returns once the current
+ * byte is handled and offset() tells where to resume.
+ *
+ * parse_in_situ() unescapes strings in place, inside of the given buffer.
+ * String and key views then point into that buffer and remain valid as
+ * long as the buffer does.
+ *
+ * After a failure error() tells what went wrong and where. Newlines are
+ * counted only when a parse() call ends in the middle of a document or
+ * at an error, a successful single call pays nothing for it.
+ *
+ * Input is UTF-8 and the engine works on raw bytes. Multibyte sequences
+ * can only appear inside of strings, they are validated there and copied
+ * as they are, without decoding to code points. put() takes one byte,
+ * not a code point.
  */
 
 #ifndef JSON_PARSER_HPP
 #define JSON_PARSER_HPP
 
+#include "span.hpp"
 #include "types.hpp"
 #include "value.hpp"
-#include "unicode/decoder.hpp"
-#include "unicode/encoder.hpp"
+#include "limits.hpp"
+#include "number.hpp"
+#include "scanner.hpp"
+#include "parse_error.hpp"
+#include "floating.hpp"
+#include "allocator.hpp"
+#include "string_view.hpp"
+
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
 
 namespace json {
 
-class Parser final : private unicode::Decoder::Observer,
-   private unicode::Encoder::Observer {
+class Atoms;
+
+/*!
+ * Parsing progress, input can be given in any number of chunks
+ */
+enum class Status {
+    NEED_MORE,
+    COMPLETE,
+    ERROR
+};
+
+/*!
+ * Handler events, every event returns true to continue parsing or false
+ * to stop it. Strings and keys are only valid during a call
+ */
+template<typename T>
+class Handler {
 public:
-    Parser() noexcept;
+    /*!
+     * Handlers that only check well-formedness hide it with false, strings
+     * are then neither buffered nor copied and numbers aren't converted
+     */
+    static constexpr bool NEEDS_VALUES{true};
+
+    bool null() noexcept;
+
+    bool boolean(Bool value) noexcept;
+
+    bool number(const Number& value) noexcept;
+
+    bool string(const StringView& value) noexcept;
+
+    bool key(const StringView& value) noexcept;
+
+    bool start_object() noexcept;
+
+    bool end_object() noexcept;
+
+    bool start_array() noexcept;
+
+    bool end_array() noexcept;
+protected:
+    Handler() noexcept = default;
+
+    ~Handler() noexcept = default;
+};
+
+/*!
+ * Deterministic automaton of BasicParser, shared by all handler types.
+ * Every byte is mapped to a character class and the state and the class
+ * select a transition. Transitions below STATE_COUNT only change the
+ * state, the rest are actions with side effects
+ */
+class ParserTable {
+public:
+    enum State : std::uint8_t {
+        STATE_ERROR,
+        STATE_IDLE,
+        STATE_END,
+        STATE_VALUE_END,
+        STATE_ARRAY_FIRST,
+        STATE_OBJECT_FIRST,
+        STATE_OBJECT_KEY,
+        STATE_OBJECT_COLON,
+        STATE_NULL_1,
+        STATE_NULL_2,
+        STATE_NULL_3,
+        STATE_TRUE_1,
+        STATE_TRUE_2,
+        STATE_TRUE_3,
+        STATE_FALSE_1,
+        STATE_FALSE_2,
+        STATE_FALSE_3,
+        STATE_FALSE_4,
+        STATE_INTEGRAL_FIRST,
+        STATE_INTEGRAL_SECOND,
+        STATE_INTEGRAL_NEXT,
+        STATE_FLOATING_DOT,
+        STATE_FLOATING_FRACTIONAL_FIRST,
+        STATE_FLOATING_FRACTIONAL_DIGIT,
+        STATE_FLOATING_EXPONENT_SIGN,
+        STATE_FLOATING_EXPONENT_FIRST,
+        STATE_FLOATING_EXPONENT_DIGIT,
+        STATE_STRING_FIRST,
+        STATE_STRING_NEXT,
+        STATE_STRING_UTF8,
+        STATE_STRING_ESCAPE,
+        STATE_STRING_UNICODE,
+        STATE_STRING_SURROGATE_1,
+        STATE_STRING_SURROGATE_2,
+        STATE_SKIP,
+        STATE_COUNT
+    };
+
+    enum Class : std::uint8_t {
+        CLASS_SPACE,
+        CLASS_WHITE,
+        CLASS_CONTROL,
+        CLASS_LCURB,
+        CLASS_RCURB,
+        CLASS_LSQRB,
+        CLASS_RSQRB,
+        CLASS_COLON,
+        CLASS_COMMA,
+        CLASS_QUOTE,
+        CLASS_BACKS,
+        CLASS_SLASH,
+        CLASS_PLUS,
+        CLASS_MINUS,
+        CLASS_POINT,
+        CLASS_ZERO,
+        CLASS_DIGIT,
+        CLASS_LOW_A,
+        CLASS_LOW_B,
+        CLASS_LOW_CD,
+        CLASS_LOW_E,
+        CLASS_LOW_F,
+        CLASS_LOW_L,
+        CLASS_LOW_N,
+        CLASS_LOW_R,
+        CLASS_LOW_S,
+        CLASS_LOW_T,
+        CLASS_LOW_U,
+        CLASS_UP_E,
+        CLASS_UP_HEX,
+        CLASS_ETC,
+        CLASS_UTF8,
+        CLASS_COUNT
+    };
+
+    enum Action : std::uint8_t {
+        ACTION_STRING = STATE_COUNT,
+        ACTION_KEY,
+        ACTION_NUMBER,
+        ACTION_NULL,
+        ACTION_TRUE,
+        ACTION_FALSE,
+        ACTION_OPEN_ARRAY,
+        ACTION_OPEN_OBJECT,
+        ACTION_CLOSE_ARRAY,
+        ACTION_CLOSE_OBJECT,
+        ACTION_COMMA,
+        ACTION_NULL_END,
+        ACTION_TRUE_END,
+        ACTION_FALSE_END,
+        ACTION_ZERO,
+        ACTION_INTEGRAL_DIGIT,
+        ACTION_FRACTIONAL_DIGIT,
+        ACTION_EXPONENT,
+        ACTION_EXPONENT_SIGN,
+        ACTION_EXPONENT_DIGIT,
+        ACTION_NUMBER_END,
+        ACTION_STRING_END,
+        ACTION_APPEND,
+        ACTION_UTF8_FIRST,
+        /* Actions that may start a run follow each other */
+        ACTION_POINT,
+        ACTION_DIGIT_FIRST,
+        ACTION_STRING_FIRST,
+        ACTION_UTF8_NEXT,
+        ACTION_ESCAPE,
+        ACTION_ESCAPE_CONTROL,
+        ACTION_UNICODE,
+        ACTION_UNICODE_DIGIT,
+        ACTION_SKIP,
+        ACTION_ERROR
+    };
+
+    static const std::uint8_t CLASSES[256];
+
+    static const std::uint8_t TRANSITIONS[STATE_COUNT][CLASS_COUNT];
+};
+
+template<typename T>
+class BasicParser final : private ParserTable {
+public:
+    explicit BasicParser(T& handler,
+            Allocator& alloc = Allocator::get_instance()) noexcept;
+
+    Status put(Char ch) noexcept;
+
+    Status parse(const Char* data, Size size) noexcept;
+
+    Status parse(const Span<const Char>& data) noexcept;
+
+    Status parse_in_situ(Char* data, Size size) noexcept;
+
+    Status finish() noexcept;
+
+    void skip_value() noexcept;
+
+    void suspend() noexcept;
+
+    /*! Accepts the next document after a complete one, offset continues */
+    void restart() noexcept;
+
+    /*!
+     * Drops the document in progress and any error, stacks and buffers
+     * are kept for the next document
+     */
+    void reset() noexcept;
+
+    /*! Stops with an error found outside of the input */
+    void fail(ParseError::Code code) noexcept;
+
+    Status status() const noexcept;
+
+    Size offset() const noexcept;
 
-    void put(char32_t ch) noexcept;
+    Size depth() const noexcept;
 
-    virtual ~Parser() noexcept override;
+    ParseError error() const noexcept;
+
+    /*! Limits apply to documents parsed after this call */
+    void set_limits(const Limits& limits) noexcept;
+
+    const Limits& limits() const noexcept;
+
+    /*!
+     * Numbers are given as raw Numbers of their text, valid during the
+     * call or inside of the parse_in_situ() buffer
+     */
+    void set_raw_numbers(bool enable) noexcept;
+
+    bool raw_numbers() const noexcept;
+
+    /*! Numbers that aren't Int or Uint become exact decimals */
+    void set_decimal_numbers(bool enable) noexcept;
+
+    bool decimal_numbers() const noexcept;
+
+    ~BasicParser() noexcept;
 private:
-    using StateHandler = void (Parser::*)(char32_t);
+    static constexpr char32_t ASCII_MAX{0x7F};
+    static constexpr char32_t CONTROL_MAX{0x1F};
 
-    virtual void unicode_decoded(char32_t ch) noexcept override;
+    static constexpr char32_t UTF8_NEXT_MIN{0x80};
+    static constexpr char32_t UTF8_NEXT_MAX{0xBF};
 
-    virtual void unicode_decoded(char32_t ch,
-            unicode::Error error) noexcept override;
+    static constexpr char32_t HIGH_SURROGATE_MIN{0xD800};
+    static constexpr char32_t HIGH_SURROGATE_MAX{0xDBFF};
+    static constexpr char32_t LOW_SURROGATE_MIN{0xDC00};
+    static constexpr char32_t LOW_SURROGATE_MAX{0xDFFF};
+    static constexpr char32_t SURROGATE_MASK{0x3FF};
+    static constexpr char32_t SUPPLEMENTARY_PLANE{0x10000};
 
-    virtual void unicode_encoded(char32_t ch) noexcept override;
+    static constexpr Size STRING_SHORT{16};
 
-    virtual void unicode_encoded(char32_t ch,
-            unicode::Error error) noexcept override;
+    static constexpr Size STACK_SIZE{32};
+    static constexpr Size STACK_BITS{8};
+    static constexpr Size BUFFER_SIZE{64};
 
-    void state_error(char32_t ch) noexcept;
+    static constexpr Int EXPONENT_MAX{100000};
 
-    void state_idle(char32_t ch) noexcept;
+    static constexpr Uint UINT_LIMIT{std::numeric_limits<Uint>::max() / 10};
+    static constexpr Uint UINT_LIMIT_DIGIT{
+        std::numeric_limits<Uint>::max() % 10};
+    static constexpr Uint INT_MAGNITUDE_MAX{
+        Uint(std::numeric_limits<Int>::max()) + 1};
 
-    void state_null_1(char32_t ch) noexcept;
+    static constexpr Uint DIGITS_LIMIT{100000000000};
 
-    void state_null_2(char32_t ch) noexcept;
+    static bool is_digit(char32_t ch) noexcept;
 
-    void state_null_3(char32_t ch) noexcept;
+    static bool is_whitespace(char32_t ch) noexcept;
 
-    void state_true_1(char32_t ch) noexcept;
+    static bool utf8_first(char32_t ch, unsigned& remaining, char32_t& min,
+            char32_t& max) noexcept;
 
-    void state_true_2(char32_t ch) noexcept;
+    static Size utf8(const std::uint8_t* bytes, Size size) noexcept;
 
-    void state_true_3(char32_t ch) noexcept;
+    static Size string_run(const Char* data, Size size) noexcept;
 
-    void state_false_1(char32_t ch) noexcept;
+    Size run(const Char* data, Size size) noexcept;
 
-    void state_false_2(char32_t ch) noexcept;
+    Status parse(const Char* data, Size size, Char* output) noexcept;
 
-    void state_false_3(char32_t ch) noexcept;
+    void step(char32_t ch) noexcept;
 
-    void state_false_4(char32_t ch) noexcept;
+    ParseError::Code syntax_error() const noexcept;
 
-    void state_integral_first(char32_t ch) noexcept;
+    void count_lines(const Char* data, Size size) noexcept;
 
-    void state_integral_second(char32_t ch) noexcept;
+    void act(Action action, char32_t ch) noexcept;
 
-    void state_integral_next(char32_t ch) noexcept;
+    bool skipped(char32_t ch) noexcept;
 
-    void state_floating_integral_digit(char32_t ch) noexcept;
+    void skip_byte(char32_t ch) noexcept;
 
-    void state_floating_dot(char32_t ch) noexcept;
+    void number_start(char32_t ch) noexcept;
 
-    void state_floating_fractional_digit(char32_t ch) noexcept;
+    void unicode_digit(char32_t ch) noexcept;
 
-    void state_floating_exponent(char32_t ch) noexcept;
+    Size skip(const Char* data, Size size) noexcept;
 
-    void state_floating_exponent_sign(char32_t ch) noexcept;
+    bool accumulate(char32_t ch) noexcept;
 
-    void state_floating_exponent_digit(char32_t ch) noexcept;
+    Size digits(const Char* data, Size size) noexcept;
 
-    void state_string_first(char32_t ch) noexcept;
+    void number_end(char32_t ch) noexcept;
 
-    void state_string_next(char32_t ch) noexcept;
+    void string_end() noexcept;
 
-    unicode::Decoder m_decoder{*this};
-    StateHandler m_state{&Parser::state_idle};
-    Value m_value{};
-    bool m_is_negative{};
-    union {
-        Uint m_uint{};
-        Double m_double;
-    };
+    Size buffer_limit() const noexcept;
+
+    void append(char32_t ch) noexcept;
+
+    void append(const Char* data, Size size) noexcept;
+
+    void append_unicode(char32_t ch) noexcept;
+
+    void in_situ(Char* output, Size size) noexcept;
+
+    void value_end(bool accepted) noexcept;
+
+    bool grow() noexcept;
+
+    bool is_in_object() const noexcept;
+
+    void open(bool is_object) noexcept;
+
+    void close(bool is_object) noexcept;
+
+    BasicParser(const BasicParser&) = delete;
+    BasicParser& operator=(const BasicParser&) = delete;
+
+    T& m_handler;
+    Allocator* m_allocator;
+    Limits m_limits{};
+    State m_state{STATE_IDLE};
+    std::uint8_t* m_stack{nullptr};
+    Size* m_members{nullptr};
+    Size m_stack_size{0};
+    Size m_depth{0};
+    Size m_offset{0};
+    Char* m_buffer{nullptr};
+    Size m_buffer_size{0};
+    Size m_buffer_length{0};
+    Char* m_storage{nullptr};
+    Size m_storage_size{0};
+    bool m_is_in_situ{false};
+    char32_t m_unicode{0};
+    char32_t m_surrogate{0};
+    unsigned m_unicode_digits{0};
+    char32_t m_utf8_min{0};
+    char32_t m_utf8_max{0};
+    unsigned m_utf8_remaining{0};
+    Size m_skip_depth{0};
+    bool m_is_skipping{false};
+    bool m_is_suspended{false};
+    bool m_is_skip_string{false};
+    bool m_is_skip_escaped{false};
+    bool m_is_key{false};
+    bool m_is_negative{false};
+    bool m_is_exponent_negative{false};
+    bool m_is_truncated{false};
+    bool m_is_inexact{false};
+    bool m_is_raw_numbers{false};
+    bool m_is_decimal_numbers{false};
+    bool m_is_raw_begin{false};
+    const Char* m_raw{nullptr};
+    Uint m_uint{0};
+    Int m_exponent{0};
+    Int m_exponent_value{0};
+    ParseError::Code m_error{ParseError::NONE};
+    Size m_lines{0};
+    Size m_line_begin{0};
 };
 
+/*!
+ * Builds a Value tree. Given an Atoms table, object keys are interned and
+ * Pair names borrow the atoms instead of allocating
+ */
+class Parser final : public Handler<Parser> {
+public:
+    Parser() noexcept;
+
+    explicit Parser(Allocator& alloc) noexcept;
+
+    Parser(Allocator& alloc, Atoms& atoms) noexcept;
+
+    Status put(Char ch) noexcept;
+
+    Status parse(const Char* data, Size size) noexcept;
+
+    Status parse(const Span<const Char>& data) noexcept;
+
+    Status parse_in_situ(Char* data, Size size) noexcept;
+
+    /*!
+     * Parses at most one document and stops right behind it, offset()
+     * tells where the rest of the input begins. A top level number must
+     * be followed by whitespace or finish()
+     */
+    Status parse_one(const Char* data, Size size) noexcept;
+
+    /*! Accepts the next document after parse_one() completed one */
+    void restart() noexcept;
+
+    /*!
+     * Drops the document in progress and any error, stacks and buffers
+     * are kept for the next document
+     */
+    void reset() noexcept;
+
+    /*! Stops with an error found outside of the input */
+    void fail(ParseError::Code code) noexcept;
+
+    Status finish() noexcept;
+
+    Status status() const noexcept;
+
+    Size offset() const noexcept;
+
+    ParseError error() const noexcept;
+
+    void set_limits(const Limits& limits) noexcept;
+
+    const Limits& limits() const noexcept;
+
+    /*! Only numbers parsed in situ stay raw, others are converted */
+    void set_raw_numbers(bool enable) noexcept;
+
+    bool raw_numbers() const noexcept;
+
+    void set_decimal_numbers(bool enable) noexcept;
+
+    bool decimal_numbers() const noexcept;
+
+    Value& value() noexcept;
+
+    const Value& value() const noexcept;
+
+    ~Parser() noexcept;
+private:
+    friend class BasicParser<Parser>;
+
+    bool null() noexcept;
+
+    bool boolean(Bool value) noexcept;
+
+    bool number(const Number& value) noexcept;
+
+    bool string(const StringView& value) noexcept;
+
+    bool key(const StringView& value) noexcept;
+
+    bool start_object() noexcept;
+
+    bool end_object() noexcept;
+
+    bool start_array() noexcept;
+
+    bool end_array() noexcept;
+
+    Value* insert(Value&& value) noexcept;
+
+    bool open(Value::Type type) noexcept;
+
+    bool value_end(bool accepted) noexcept;
+
+    Parser(const Parser&) = delete;
+    Parser& operator=(const Parser&) = delete;
+
+    Allocator* m_allocator;
+    Value m_value;
+    Value** m_stack{nullptr};
+    Size m_stack_size{0};
+    Size m_depth{0};
+    String m_key;
+    Atoms* m_atoms{nullptr};
+    bool m_is_in_situ{false};
+    bool m_is_one{false};
+    BasicParser<Parser> m_parser;
+};
+
+template<typename T> constexpr bool Handler<T>::NEEDS_VALUES;
+
+template<typename T> inline auto
+Handler<T>::null() noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::boolean(Bool) noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::number(const Number&) noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::string(const StringView&) noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::key(const StringView&) noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::start_object() noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::end_object() noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::start_array() noexcept -> bool {
+    return true;
+}
+
+template<typename T> inline auto
+Handler<T>::end_array() noexcept -> bool {
+    return true;
+}
+
+template<typename T> constexpr char32_t BasicParser<T>::ASCII_MAX;
+template<typename T> constexpr char32_t BasicParser<T>::CONTROL_MAX;
+template<typename T> constexpr char32_t BasicParser<T>::UTF8_NEXT_MIN;
+template<typename T> constexpr char32_t BasicParser<T>::UTF8_NEXT_MAX;
+template<typename T> constexpr char32_t BasicParser<T>::HIGH_SURROGATE_MIN;
+template<typename T> constexpr char32_t BasicParser<T>::HIGH_SURROGATE_MAX;
+template<typename T> constexpr char32_t BasicParser<T>::LOW_SURROGATE_MIN;
+template<typename T> constexpr char32_t BasicParser<T>::LOW_SURROGATE_MAX;
+template<typename T> constexpr char32_t BasicParser<T>::SURROGATE_MASK;
+template<typename T> constexpr char32_t BasicParser<T>::SUPPLEMENTARY_PLANE;
+template<typename T> constexpr Size BasicParser<T>::STACK_SIZE;
+template<typename T> constexpr Size BasicParser<T>::STACK_BITS;
+template<typename T> constexpr Size BasicParser<T>::BUFFER_SIZE;
+template<typename T> constexpr Int BasicParser<T>::EXPONENT_MAX;
+template<typename T> constexpr Uint BasicParser<T>::UINT_LIMIT;
+template<typename T> constexpr Uint BasicParser<T>::UINT_LIMIT_DIGIT;
+template<typename T> constexpr Uint BasicParser<T>::INT_MAGNITUDE_MAX;
+template<typename T> constexpr Uint BasicParser<T>::DIGITS_LIMIT;
+
+template<typename T>
+BasicParser<T>::BasicParser(T& handler, Allocator& alloc) noexcept :
+    m_handler{handler},
+    m_allocator{&alloc}
+{
+    static_assert(std::is_base_of<Handler<T>, T>::value,
+            "T must derive from json::Handler<T>");
+
+    /* Nesting stack is reserved upfront, deep documents grow it. Every
+     * level takes one bit, set for objects */
+    m_stack = m_allocator->template allocate<std::uint8_t>(
+            STACK_SIZE / STACK_BITS);
+    if (m_stack) {
+        m_stack_size = STACK_SIZE;
+    }
+}
+
+template<typename T>
+BasicParser<T>::~BasicParser() noexcept {
+    m_allocator->deallocate(m_is_in_situ ? m_storage : m_buffer);
+    m_allocator->deallocate(m_members);
+    m_allocator->deallocate(m_stack);
+}
+
+template<typename T> inline auto
+BasicParser<T>::put(Char ch) noexcept -> Status {
+    if (m_state != STATE_ERROR) {
+        if (m_offset >= m_limits.document_size) {
+            fail(ParseError::DOCUMENT_LIMIT);
+        }
+        else {
+            step(std::uint8_t(ch));
+        }
+
+        m_is_suspended = false;
+
+        if (m_state != STATE_ERROR) {
+            if ('\n' == ch) {
+                ++m_lines;
+                m_line_begin = m_offset + 1;
+            }
+
+            ++m_offset;
+        }
+    }
+
+    return status();
+}
+
+template<typename T> inline auto
+BasicParser<T>::parse(const Span<const Char>& data) noexcept -> Status {
+    return parse(data.data(), data.size());
+}
+
+template<typename T> inline auto
+BasicParser<T>::parse(const Char* data, Size size) noexcept -> Status {
+    return parse(data, size, nullptr);
+}
+
+template<typename T> auto
+BasicParser<T>::parse_in_situ(Char* data, Size size) noexcept -> Status {
+    /* Strings are written behind the read position, the whole document
+     * must be given at once */
+    parse(data, size, data);
+
+    return finish();
+}
+
+template<typename T> inline auto
+BasicParser<T>::status() const noexcept -> Status {
+    if (m_state == STATE_END) {
+        return Status::COMPLETE;
+    }
+
+    if (m_state == STATE_ERROR) {
+        return Status::ERROR;
+    }
+
+    return Status::NEED_MORE;
+}
+
+template<typename T> inline auto
+BasicParser<T>::offset() const noexcept -> Size {
+    return m_offset;
+}
+
+template<typename T> auto
+BasicParser<T>::finish() noexcept -> Status {
+    /* End of input terminates a top level number like whitespace does,
+     * anything else still pending is a truncated document. Open strings
+     * aren't stepped, in situ they have no room left to grow */
+    if ((m_state < STATE_STRING_FIRST) ||
+            (m_state > STATE_STRING_SURROGATE_2)) {
+        step(' ');
+    }
+
+    if ((m_state != STATE_END) && (m_state != STATE_ERROR)) {
+        fail(ParseError::UNEXPECTED_END);
+    }
+
+    return status();
+}
+
+template<typename T> inline auto
+BasicParser<T>::is_digit(char32_t ch) noexcept -> bool {
+    return (ch >= '0') && (ch <= '9');
+}
+
+template<typename T> inline auto
+BasicParser<T>::is_whitespace(char32_t ch) noexcept -> bool {
+    return (' ' == ch) || ('\t' == ch) || ('\n' == ch) || ('\r' == ch);
+}
+
+template<typename T> void
+BasicParser<T>::skip_value() noexcept {
+    /* Container that was just opened is skipped to its end */
+    if ((m_state == STATE_ARRAY_FIRST) ||
+            (m_state == STATE_OBJECT_FIRST)) {
+        --m_depth;
+        m_skip_depth = 1;
+        m_is_skip_string = false;
+        m_is_skip_escaped = false;
+        m_state = STATE_SKIP;
+    }
+    else {
+        m_is_skipping = true;
+    }
+}
+
+template<typename T> inline void
+BasicParser<T>::suspend() noexcept {
+    m_is_suspended = true;
+}
+
+template<typename T> inline void
+BasicParser<T>::restart() noexcept {
+    if (m_state == STATE_END) {
+        m_state = STATE_IDLE;
+    }
+}
+
+template<typename T> void
+BasicParser<T>::reset() noexcept {
+    if (m_is_in_situ) {
+        m_buffer = m_storage;
+        m_buffer_size = m_storage_size;
+        m_is_in_situ = false;
+    }
+
+    m_state = STATE_IDLE;
+    m_depth = 0;
+    m_offset = 0;
+    m_buffer_length = 0;
+    m_is_skipping = false;
+    m_is_suspended = false;
+    m_error = ParseError::NONE;
+    m_lines = 0;
+    m_line_begin = 0;
+}
+
+template<typename T> inline auto
+BasicParser<T>::depth() const noexcept -> Size {
+    return m_depth;
+}
+
+template<typename T> inline void
+BasicParser<T>::set_limits(const Limits& limits) noexcept {
+    m_limits = limits;
+}
+
+template<typename T> inline auto
+BasicParser<T>::limits() const noexcept -> const Limits& {
+    return m_limits;
+}
+
+template<typename T> inline void
+BasicParser<T>::set_raw_numbers(bool enable) noexcept {
+    m_is_raw_numbers = enable;
+}
+
+template<typename T> inline auto
+BasicParser<T>::raw_numbers() const noexcept -> bool {
+    return m_is_raw_numbers;
+}
+
+template<typename T> inline void
+BasicParser<T>::set_decimal_numbers(bool enable) noexcept {
+    m_is_decimal_numbers = enable;
+}
+
+template<typename T> inline auto
+BasicParser<T>::decimal_numbers() const noexcept -> bool {
+    return m_is_decimal_numbers;
+}
+
+template<typename T> auto
+BasicParser<T>::error() const noexcept -> ParseError {
+    if (m_state != STATE_ERROR) {
+        return {};
+    }
+
+    return {m_error, m_offset, m_lines + 1, m_offset - m_line_begin + 1};
+}
+
+template<typename T> inline void
+BasicParser<T>::fail(ParseError::Code code) noexcept {
+    m_error = code;
+    m_state = STATE_ERROR;
+}
+
+template<typename T> auto
+BasicParser<T>::syntax_error() const noexcept -> ParseError::Code {
+    switch (m_state) {
+    case STATE_END:
+        return ParseError::TRAILING_CHARACTERS;
+    case STATE_NULL_1:
+    case STATE_NULL_2:
+    case STATE_NULL_3:
+    case STATE_TRUE_1:
+    case STATE_TRUE_2:
+    case STATE_TRUE_3:
+    case STATE_FALSE_1:
+    case STATE_FALSE_2:
+    case STATE_FALSE_3:
+    case STATE_FALSE_4:
+        return ParseError::INVALID_LITERAL;
+    case STATE_INTEGRAL_FIRST:
+    case STATE_INTEGRAL_SECOND:
+    case STATE_INTEGRAL_NEXT:
+    case STATE_FLOATING_DOT:
+    case STATE_FLOATING_FRACTIONAL_FIRST:
+    case STATE_FLOATING_FRACTIONAL_DIGIT:
+    case STATE_FLOATING_EXPONENT_SIGN:
+    case STATE_FLOATING_EXPONENT_FIRST:
+    case STATE_FLOATING_EXPONENT_DIGIT:
+        return ParseError::INVALID_NUMBER;
+    case STATE_STRING_NEXT:
+        return ParseError::CONTROL_CHARACTER;
+    case STATE_STRING_UTF8:
+        return ParseError::INVALID_UTF8;
+    case STATE_STRING_ESCAPE:
+        return ParseError::INVALID_ESCAPE;
+    case STATE_STRING_UNICODE:
+    case STATE_STRING_SURROGATE_1:
+    case STATE_STRING_SURROGATE_2:
+        return ParseError::INVALID_UNICODE_ESCAPE;
+    case STATE_ERROR:
+    case STATE_IDLE:
+    case STATE_VALUE_END:
+    case STATE_ARRAY_FIRST:
+    case STATE_OBJECT_FIRST:
+    case STATE_OBJECT_KEY:
+    case STATE_OBJECT_COLON:
+    case STATE_STRING_FIRST:
+    case STATE_SKIP:
+    case STATE_COUNT:
+    default:
+        return ParseError::UNEXPECTED_CHARACTER;
+    }
+}
+
+template<typename T> void
+BasicParser<T>::count_lines(const Char* data, Size size) noexcept {
+    auto last = data + size;
+    auto newline = std::find(data, last, '\n');
+
+    while (newline != last) {
+        ++m_lines;
+        m_line_begin = m_offset + Size(newline - data) + 1;
+        newline = std::find(newline + 1, last, '\n');
+    }
+}
+
+template<typename T> void
+BasicParser<T>::value_end(bool accepted) noexcept {
+    if (!accepted) {
+        fail(ParseError::HANDLER_REJECTED);
+    }
+    else if (m_depth) {
+        m_state = STATE_VALUE_END;
+    }
+    else {
+        m_state = STATE_END;
+    }
+}
+
+template<typename T> bool
+BasicParser<T>::grow() noexcept {
+    auto size = m_stack_size ? (2 * m_stack_size) : STACK_SIZE;
+
+    if (m_depth >= m_stack_size) {
+        auto stack = m_allocator->reallocate(m_stack, size / STACK_BITS);
+
+        if (!stack) {
+            return false;
+        }
+
+        m_stack = stack;
+    }
+    else {
+        size = m_stack_size;
+    }
+
+    /* Member counters are allocated once members are limited, later
+     * they follow the stack even when the limit is lifted */
+    if ((m_members || (m_limits.members != Limits::NO_LIMIT)) &&
+            (!m_members || (size != m_stack_size))) {
+        auto members = m_allocator->reallocate(m_members, size);
+
+        if (!members) {
+            return false;
+        }
+
+        m_members = members;
+    }
+
+    m_stack_size = size;
+
+    return true;
+}
+
+template<typename T> inline auto
+BasicParser<T>::is_in_object() const noexcept -> bool {
+    auto level = m_depth - 1;
+    return 0 != (m_stack[level / STACK_BITS] & (1u << (level % STACK_BITS)));
+}
+
+template<typename T> void
+BasicParser<T>::open(bool is_object) noexcept {
+    if (m_depth >= m_limits.depth) {
+        fail(ParseError::DEPTH_LIMIT);
+        return;
+    }
+
+    if (((m_depth >= m_stack_size) || (!m_members &&
+                    (m_limits.members != Limits::NO_LIMIT))) && !grow()) {
+        fail(ParseError::OUT_OF_MEMORY);
+        return;
+    }
+
+    auto accepted = is_object ? m_handler.start_object() :
+        m_handler.start_array();
+
+    if (accepted && m_is_skipping) {
+        m_is_skipping = false;
+        m_skip_depth = 1;
+        m_is_skip_string = false;
+        m_is_skip_escaped = false;
+        m_state = STATE_SKIP;
+    }
+    else if (accepted) {
+        if (m_members) {
+            m_members[m_depth] = 0;
+        }
+
+        auto bit = std::uint8_t(1u << (m_depth % STACK_BITS));
+
+        if (is_object) {
+            m_stack[m_depth / STACK_BITS] |= bit;
+        }
+        else {
+            m_stack[m_depth / STACK_BITS] &= std::uint8_t(~bit);
+        }
+
+        ++m_depth;
+        m_state = is_object ? STATE_OBJECT_FIRST :
+            STATE_ARRAY_FIRST;
+    }
+    else {
+        fail(ParseError::HANDLER_REJECTED);
+    }
+}
+
+template<typename T> void
+BasicParser<T>::close(bool is_object) noexcept {
+    if (m_depth && (is_in_object() == is_object)) {
+        --m_depth;
+        value_end(is_object ? m_handler.end_object() : m_handler.end_array());
+    }
+    else {
+        fail(ParseError::MISMATCHED_BRACKET);
+    }
+}
+
+template<typename T> auto
+BasicParser<T>::parse(const Char* data, Size size,
+        Char* output) noexcept -> Status {
+    if (m_state == STATE_ERROR) {
+        return Status::ERROR;
+    }
+
+    if (size > (m_limits.document_size - m_offset)) {
+        size = m_limits.document_size - m_offset;
+        count_lines(data, size);
+        m_offset += size;
+        fail(ParseError::DOCUMENT_LIMIT);
+        return Status::ERROR;
+    }
+
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(data);
+    Size position = 0;
+
+    while (position < size) {
+        auto ch = char32_t(bytes[position++]);
+        auto transition = TRANSITIONS[m_state][CLASSES[ch]];
+
+        /* Most bytes only change the state */
+        if (transition < STATE_COUNT) {
+            m_state = State(transition);
+            continue;
+        }
+
+        act(Action(transition), ch);
+
+        if (m_state == STATE_ERROR) {
+            count_lines(data, position - 1);
+            m_offset += position - 1;
+            return Status::ERROR;
+        }
+
+        if (output) {
+            if (m_state == STATE_STRING_FIRST) {
+                in_situ(output + position, size - position);
+            }
+            else if (m_is_raw_begin) {
+                /* Raw numbers refer to their text in the buffer */
+                m_raw = output + position - 1;
+                m_is_raw_begin = false;
+            }
+        }
+
+        if (m_is_suspended) {
+            m_is_suspended = false;
+            count_lines(data, position);
+            m_offset += position;
+            return status();
+        }
+
+        if (m_state == STATE_SKIP) {
+            position += skip(data + position, size - position);
+            continue;
+        }
+
+        /* Token-dense input passes with one compare, short strings end
+         * before their run is worth a call */
+        if ((transition >= ACTION_POINT) &&
+                (transition <= ACTION_ESCAPE_CONTROL) && (position < size) &&
+                (CLASSES[bytes[position]] != CLASS_QUOTE)) {
+            position += run(data + position, size - position);
+
+            if (m_state == STATE_ERROR) {
+                count_lines(data, position);
+                m_offset += position;
+                return Status::ERROR;
+            }
+        }
+    }
+
+    /* Lines are counted only for the position of a later error, a
+     * complete document doesn't need them */
+    if (m_state != STATE_END) {
+        count_lines(data, size);
+    }
+
+    m_offset += size;
+
+    return status();
+}
+
+template<typename T> auto
+BasicParser<T>::utf8_first(char32_t ch, unsigned& remaining, char32_t& min,
+        char32_t& max) noexcept -> bool {
+    /* Second byte ranges reject overlong forms, surrogates and code
+     * points above U+10FFFF, as in Table 3-7 of the Unicode Standard */
+    min = UTF8_NEXT_MIN;
+    max = UTF8_NEXT_MAX;
+
+    if ((ch >= 0xC2) && (ch <= 0xDF)) {
+        remaining = 1;
+    }
+    else if ((ch >= 0xE0) && (ch <= 0xEF)) {
+        remaining = 2;
+
+        if (0xE0 == ch) {
+            min = 0xA0;
+        }
+        else if (0xED == ch) {
+            max = 0x9F;
+        }
+    }
+    else if ((ch >= 0xF0) && (ch <= 0xF4)) {
+        remaining = 3;
+
+        if (0xF0 == ch) {
+            min = 0x90;
+        }
+        else if (0xF4 == ch) {
+            max = 0x8F;
+        }
+    }
+    else {
+        return false;
+    }
+
+    return true;
+}
+
+template<typename T> auto
+BasicParser<T>::utf8(const std::uint8_t* bytes, Size size) noexcept -> Size {
+    Size count = 0;
+
+    while ((count < size) && (bytes[count] > ASCII_MAX)) {
+        unsigned remaining = 0;
+        char32_t min = 0;
+        char32_t max = 0;
+
+        if (!utf8_first(bytes[count], remaining, min, max) ||
+                ((count + remaining) >= size) ||
+                (bytes[count + 1] < min) || (bytes[count + 1] > max)) {
+            break;
+        }
+
+        unsigned next = 2;
+
+        while ((next <= remaining) &&
+                (bytes[count + next] >= UTF8_NEXT_MIN) &&
+                (bytes[count + next] <= UTF8_NEXT_MAX)) {
+            ++next;
+        }
+
+        if (next <= remaining) {
+            break;
+        }
+
+        count += remaining + 1;
+    }
+
+    return count;
+}
+
+template<typename T> auto
+BasicParser<T>::string_run(const Char* data, Size size) noexcept -> Size {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(data);
+    Size count = 0;
+
+    while (count < size) {
+        /* Short strings end before a block scan would pay off */
+        if ((count >= STRING_SHORT) &&
+                ((size - count) >= Scanner::BLOCK_SIZE)) {
+            auto stops = Scanner::string_stops(data + count);
+
+            if (!stops) {
+                count += Scanner::BLOCK_SIZE;
+                continue;
+            }
+
+            count += count_trailing_zeros(stops);
+        }
+
+        auto ch = bytes[count];
+
+        if (ch > ASCII_MAX) {
+            /* Complete multibyte sequences are validated in place */
+            auto length = utf8(bytes + count, size - count);
+
+            if (!length) {
+                break;
+            }
+
+            count += length;
+        }
+        else if (ACTION_APPEND == TRANSITIONS[STATE_STRING_NEXT][CLASSES[ch]]) {
+            ++count;
+        }
+        else {
+            break;
+        }
+    }
+
+    return count;
+}
+
+/* Bytes that can't change the state are jumped over after the action that
+ * started their run, errors are at the byte that caused them */
+template<typename T> Size
+BasicParser<T>::run(const Char* data, Size size) noexcept {
+    if (m_state != STATE_STRING_NEXT) {
+        /* Long digit runs are converted 8 at a time */
+        return ((size >= floating::DIGITS_SIZE) && is_digit(char32_t(
+                std::uint8_t(data[floating::DIGITS_SIZE - 1])))) ?
+            digits(data, size) : 0;
+    }
+
+    auto count = string_run(data, size);
+    auto length = m_buffer_length;
+
+    if (count) {
+        append(data, count);
+
+        if ((m_state == STATE_ERROR) &&
+                (ParseError::STRING_LIMIT == m_error)) {
+            count = m_limits.string_length - length;
+        }
+    }
+
+    return count;
+}
+
+/* String length limit doesn't apply to number text */
+template<typename T> inline auto
+BasicParser<T>::buffer_limit() const noexcept -> Size {
+    return ((m_state >= STATE_INTEGRAL_FIRST) &&
+            (m_state <= STATE_FLOATING_EXPONENT_DIGIT)) ?
+        Limits::NO_LIMIT : m_limits.string_length;
+}
+
+template<typename T> void
+BasicParser<T>::append(char32_t ch) noexcept {
+    if (!T::NEEDS_VALUES) {
+        return;
+    }
+
+    if (m_buffer_length >= buffer_limit()) {
+        fail(ParseError::STRING_LIMIT);
+        return;
+    }
+
+    if ((m_buffer_length >= m_buffer_size) && m_is_in_situ) {
+        fail(ParseError::UNEXPECTED_END);
+        return;
+    }
+
+    if (m_buffer_length >= m_buffer_size) {
+        auto size = m_buffer_size ? (2 * m_buffer_size) : BUFFER_SIZE;
+        auto buffer = m_allocator->reallocate(m_buffer, size);
+
+        if (!buffer) {
+            fail(ParseError::OUT_OF_MEMORY);
+            return;
+        }
+
+        m_buffer = buffer;
+        m_buffer_size = size;
+    }
+
+    m_buffer[m_buffer_length++] = Char(ch);
+}
+
+template<typename T> void
+BasicParser<T>::append(const Char* data, Size size) noexcept {
+    if (!T::NEEDS_VALUES) {
+        return;
+    }
+
+    if (size > (buffer_limit() - m_buffer_length)) {
+        fail(ParseError::STRING_LIMIT);
+        return;
+    }
+
+    /* In situ buffer is the caller's input, it can't grow */
+    if (((m_buffer_length + size) > m_buffer_size) && m_is_in_situ) {
+        fail(ParseError::UNEXPECTED_END);
+        return;
+    }
+
+    if ((m_buffer_length + size) > m_buffer_size) {
+        auto required = m_buffer_length + size;
+        auto buffer_size = m_buffer_size ? m_buffer_size : BUFFER_SIZE;
+
+        while (buffer_size < required) {
+            buffer_size *= 2;
+        }
+
+        auto buffer = m_allocator->reallocate(m_buffer, buffer_size);
+
+        if (!buffer) {
+            fail(ParseError::OUT_OF_MEMORY);
+            return;
+        }
+
+        m_buffer = buffer;
+        m_buffer_size = buffer_size;
+    }
+
+    /* In situ output never overtakes its input */
+    if (data != (m_buffer + m_buffer_length)) {
+        std::copy(data, data + size, m_buffer + m_buffer_length);
+    }
+
+    m_buffer_length += size;
+}
+
+template<typename T> void
+BasicParser<T>::append_unicode(char32_t ch) noexcept {
+    if (ch <= ASCII_MAX) {
+        append(ch);
+    }
+    else if (ch <= 0x7FF) {
+        append(0xC0 | (ch >> 6));
+        append(0x80 | (ch & 0x3F));
+    }
+    else if (ch <= 0xFFFF) {
+        append(0xE0 | (ch >> 12));
+        append(0x80 | ((ch >> 6) & 0x3F));
+        append(0x80 | (ch & 0x3F));
+    }
+    else {
+        append(0xF0 | (ch >> 18));
+        append(0x80 | ((ch >> 12) & 0x3F));
+        append(0x80 | ((ch >> 6) & 0x3F));
+        append(0x80 | (ch & 0x3F));
+    }
+}
+
+template<typename T> void
+BasicParser<T>::in_situ(Char* output, Size size) noexcept {
+    if (!m_is_in_situ) {
+        m_storage = m_buffer;
+        m_storage_size = m_buffer_size;
+        m_is_in_situ = true;
+    }
+
+    m_buffer = output;
+    m_buffer_size = size;
+}
+
+template<typename T> inline void
+BasicParser<T>::step(char32_t ch) noexcept {
+    auto transition = TRANSITIONS[m_state][CLASSES[ch]];
+
+    if (transition < STATE_COUNT) {
+        m_state = State(transition);
+    }
+    else if (ACTION_APPEND == transition) {
+        /* String bodies don't need the action switch */
+        append(ch);
+    }
+    else if (((ACTION_INTEGRAL_DIGIT == transition) ||
+                (ACTION_FRACTIONAL_DIGIT == transition)) &&
+            (m_uint < UINT_LIMIT)) {
+        /* Neither do digits while the significand has room */
+        append(ch);
+        m_uint = (10 * m_uint) + Uint(ch - '0');
+
+        if (ACTION_FRACTIONAL_DIGIT == transition) {
+            --m_exponent;
+            m_state = STATE_FLOATING_FRACTIONAL_DIGIT;
+        }
+    }
+    else {
+        act(Action(transition), ch);
+    }
+}
+
+template<typename T> void
+BasicParser<T>::act(Action action, char32_t ch) noexcept {
+    switch (action) {
+    case ACTION_STRING:
+        if (!skipped(ch)) {
+            m_is_key = false;
+            m_state = STATE_STRING_FIRST;
+        }
+        break;
+    case ACTION_KEY:
+        if (m_members &&
+                (++m_members[m_depth - 1] > m_limits.members)) {
+            fail(ParseError::MEMBERS_LIMIT);
+            break;
+        }
+        m_is_key = true;
+        m_state = STATE_STRING_FIRST;
+        break;
+    case ACTION_NUMBER:
+        if (!skipped(ch)) {
+            number_start(ch);
+        }
+        break;
+    case ACTION_NULL:
+        if (!skipped(ch)) {
+            m_state = STATE_NULL_1;
+        }
+        break;
+    case ACTION_TRUE:
+        if (!skipped(ch)) {
+            m_state = STATE_TRUE_1;
+        }
+        break;
+    case ACTION_FALSE:
+        if (!skipped(ch)) {
+            m_state = STATE_FALSE_1;
+        }
+        break;
+    case ACTION_OPEN_ARRAY:
+        if (!skipped(ch)) {
+            open(false);
+        }
+        break;
+    case ACTION_OPEN_OBJECT:
+        if (!skipped(ch)) {
+            open(true);
+        }
+        break;
+    case ACTION_CLOSE_ARRAY:
+        close(false);
+        break;
+    case ACTION_CLOSE_OBJECT:
+        close(true);
+        break;
+    case ACTION_COMMA:
+        m_state = is_in_object() ? STATE_OBJECT_KEY : STATE_IDLE;
+        break;
+    case ACTION_NULL_END:
+        value_end(m_handler.null());
+        break;
+    case ACTION_TRUE_END:
+        value_end(m_handler.boolean(true));
+        break;
+    case ACTION_FALSE_END:
+        value_end(m_handler.boolean(false));
+        break;
+    case ACTION_ZERO:
+        append(ch);
+        m_state = STATE_FLOATING_DOT;
+        break;
+    case ACTION_DIGIT_FIRST:
+        append(ch);
+        m_uint = Uint(ch - '0');
+        m_state = STATE_INTEGRAL_NEXT;
+        break;
+    case ACTION_INTEGRAL_DIGIT:
+        append(ch);
+        if (!accumulate(ch)) {
+            ++m_exponent;
+        }
+        break;
+    case ACTION_POINT:
+        append(ch);
+        m_state = STATE_FLOATING_FRACTIONAL_FIRST;
+        break;
+    case ACTION_FRACTIONAL_DIGIT:
+        append(ch);
+        if (accumulate(ch)) {
+            --m_exponent;
+        }
+        m_state = STATE_FLOATING_FRACTIONAL_DIGIT;
+        break;
+    case ACTION_EXPONENT:
+        append(ch);
+        m_state = STATE_FLOATING_EXPONENT_SIGN;
+        break;
+    case ACTION_EXPONENT_SIGN:
+        m_is_exponent_negative = ('-' == ch);
+        append(ch);
+        m_state = STATE_FLOATING_EXPONENT_FIRST;
+        break;
+    case ACTION_EXPONENT_DIGIT:
+        append(ch);
+        if (m_exponent_value < EXPONENT_MAX) {
+            m_exponent_value = (10 * m_exponent_value) + Int(ch - '0');
+        }
+        m_state = STATE_FLOATING_EXPONENT_DIGIT;
+        break;
+    case ACTION_NUMBER_END:
+        number_end(ch);
+        break;
+    case ACTION_STRING_FIRST:
+        m_buffer_length = 0;
+        m_state = STATE_STRING_NEXT;
+        step(ch);
+        break;
+    case ACTION_STRING_END:
+        string_end();
+        break;
+    case ACTION_APPEND:
+        append(ch);
+        break;
+    case ACTION_UTF8_FIRST:
+        if (utf8_first(ch, m_utf8_remaining, m_utf8_min, m_utf8_max)) {
+            append(ch);
+            m_state = STATE_STRING_UTF8;
+        }
+        else {
+            fail(ParseError::INVALID_UTF8);
+        }
+        break;
+    case ACTION_UTF8_NEXT:
+        if ((ch < m_utf8_min) || (ch > m_utf8_max)) {
+            fail(ParseError::INVALID_UTF8);
+            break;
+        }
+
+        append(ch);
+
+        m_utf8_min = UTF8_NEXT_MIN;
+        m_utf8_max = UTF8_NEXT_MAX;
+
+        if (0 == --m_utf8_remaining) {
+            m_state = STATE_STRING_NEXT;
+        }
+        break;
+    case ACTION_ESCAPE:
+        append(ch);
+        m_state = STATE_STRING_NEXT;
+        break;
+    case ACTION_ESCAPE_CONTROL:
+        append(('b' == ch) ? '\b' : ('f' == ch) ? '\f' : ('n' == ch) ? '\n' :
+                ('r' == ch) ? '\r' : '\t');
+        m_state = STATE_STRING_NEXT;
+        break;
+    case ACTION_UNICODE:
+        m_unicode = 0;
+        m_unicode_digits = 0;
+        m_state = STATE_STRING_UNICODE;
+        break;
+    case ACTION_UNICODE_DIGIT:
+        unicode_digit(ch);
+        break;
+    case ACTION_SKIP:
+        skip_byte(ch);
+        break;
+    case ACTION_ERROR:
+        if (m_state != STATE_ERROR) {
+            fail(syntax_error());
+        }
+        break;
+    default:
+        fail(ParseError::UNEXPECTED_CHARACTER);
+        break;
+    }
+}
+
+template<typename T> auto
+BasicParser<T>::skipped(char32_t ch) noexcept -> bool {
+    if (!m_is_skipping) {
+        return false;
+    }
+
+    m_is_skipping = false;
+    m_skip_depth = 0;
+    m_is_skip_string = false;
+    m_is_skip_escaped = false;
+    m_state = STATE_SKIP;
+    skip_byte(ch);
+
+    return true;
+}
+
+template<typename T> void
+BasicParser<T>::number_start(char32_t ch) noexcept {
+    m_uint = 0;
+    m_exponent = 0;
+    m_exponent_value = 0;
+    m_buffer_length = 0;
+    m_is_truncated = false;
+    m_is_inexact = false;
+    m_is_exponent_negative = false;
+    m_is_negative = ('-' == ch);
+    m_is_raw_begin = m_is_raw_numbers;
+    m_raw = nullptr;
+    m_state = STATE_INTEGRAL_SECOND;
+
+    if (m_is_negative) {
+        append(ch);
+    }
+    else {
+        step(ch);
+    }
+}
+
+template<typename T> void
+BasicParser<T>::unicode_digit(char32_t ch) noexcept {
+    if (ch <= '9') {
+        m_unicode = (m_unicode << 4) | (ch - '0');
+    }
+    else {
+        m_unicode = (m_unicode << 4) | ((ch | 0x20) - 'a' + 10);
+    }
+
+    if (++m_unicode_digits < 4) {
+        return;
+    }
+
+    /* Code points outside of the basic multilingual plane are escaped
+     * as two UTF-16 surrogates, \uD83D\uDE00 */
+    if (m_surrogate) {
+        if ((m_unicode >= LOW_SURROGATE_MIN) &&
+                (m_unicode <= LOW_SURROGATE_MAX)) {
+            append_unicode(char32_t(SUPPLEMENTARY_PLANE +
+                ((m_surrogate & SURROGATE_MASK) << 10) +
+                (m_unicode & SURROGATE_MASK)));
+            m_surrogate = 0;
+            m_state = STATE_STRING_NEXT;
+        }
+        else {
+            fail(ParseError::INVALID_UNICODE_ESCAPE);
+        }
+    }
+    else if ((m_unicode >= HIGH_SURROGATE_MIN) &&
+            (m_unicode <= HIGH_SURROGATE_MAX)) {
+        m_surrogate = m_unicode;
+        m_state = STATE_STRING_SURROGATE_1;
+    }
+    else if ((m_unicode >= LOW_SURROGATE_MIN) &&
+            (m_unicode <= LOW_SURROGATE_MAX)) {
+        fail(ParseError::INVALID_UNICODE_ESCAPE);
+    }
+    else {
+        append_unicode(m_unicode);
+        m_state = STATE_STRING_NEXT;
+    }
+}
+
+template<typename T> void
+BasicParser<T>::string_end() noexcept {
+    StringView string{m_buffer, m_buffer_length};
+
+    if (m_is_in_situ) {
+        m_buffer = m_storage;
+        m_buffer_size = m_storage_size;
+        m_is_in_situ = false;
+    }
+
+    if (!m_is_key) {
+        value_end(m_handler.string(string));
+    }
+    else if (m_handler.key(string)) {
+        m_state = STATE_OBJECT_COLON;
+    }
+    else {
+        fail(ParseError::HANDLER_REJECTED);
+    }
+}
+
+template<typename T> void
+BasicParser<T>::skip_byte(char32_t ch) noexcept {
+    if (m_is_skip_string) {
+        if (m_is_skip_escaped) {
+            m_is_skip_escaped = false;
+        }
+        else if ('\\' == ch) {
+            m_is_skip_escaped = true;
+        }
+        else if ('\"' == ch) {
+            m_is_skip_string = false;
+
+            if (0 == m_skip_depth) {
+                value_end(true);
+            }
+        }
+    }
+    else if ('\"' == ch) {
+        m_is_skip_string = true;
+    }
+    else if (('[' == ch) || ('{' == ch)) {
+        ++m_skip_depth;
+    }
+    else if (m_skip_depth) {
+        if ((']' == ch) || ('}' == ch)) {
+            if (0 == --m_skip_depth) {
+                value_end(true);
+            }
+        }
+    }
+    else if ((',' == ch) || (']' == ch) || ('}' == ch) || is_whitespace(ch)) {
+        /* Scalars end at the first delimiter, it belongs to the parent */
+        value_end(true);
+        step(ch);
+    }
+}
+
+template<typename T> auto
+BasicParser<T>::skip(const Char* data, Size size) noexcept -> Size {
+    Scanner scanner{m_is_skip_string, m_is_skip_escaped};
+    Scanner::Block block;
+
+    for (Size offset = 0; offset < size; offset += Scanner::BLOCK_SIZE) {
+        auto count = size - offset;
+
+        if (count > Scanner::BLOCK_SIZE) {
+            count = Scanner::BLOCK_SIZE;
+        }
+
+        scanner.scan(data + offset, count, block);
+
+        if (m_skip_depth) {
+            auto brackets = block.open | block.close;
+
+            while (brackets) {
+                auto position = count_trailing_zeros(brackets);
+                auto bit = brackets & (~brackets + 1);
+
+                brackets ^= bit;
+
+                if (block.open & bit) {
+                    ++m_skip_depth;
+                }
+                else if (0 == --m_skip_depth) {
+                    value_end(true);
+                    return offset + position + 1;
+                }
+            }
+        }
+        else if (m_is_skip_string) {
+            /* Closing quote is the first byte outside of the string */
+            auto outside = ~block.string;
+            auto position = outside ? count_trailing_zeros(outside) : count;
+
+            if (position < count) {
+                m_is_skip_string = false;
+                value_end(true);
+                return offset + position + 1;
+            }
+        }
+        else {
+            auto stops = block.structural | block.whitespace;
+
+            if (stops) {
+                value_end(true);
+                return offset + count_trailing_zeros(stops);
+            }
+        }
+
+        m_is_skip_string = scanner.in_string();
+        m_is_skip_escaped = scanner.escaped();
+    }
+
+    return size;
+}
+
+template<typename T> bool
+BasicParser<T>::accumulate(char32_t ch) noexcept {
+    auto digit = Uint(ch - '0');
+
+    /* Significand keeps as many leading digits as fit in Uint,
+     * the rest only shifts the decimal exponent */
+    if (!m_is_truncated && ((m_uint < UINT_LIMIT) ||
+                ((UINT_LIMIT == m_uint) && (digit <= UINT_LIMIT_DIGIT)))) {
+        m_uint = (10 * m_uint) + digit;
+        return true;
+    }
+
+    m_is_truncated = true;
+    if (digit) {
+        m_is_inexact = true;
+    }
+
+    return false;
+}
+
+template<typename T> Size
+BasicParser<T>::digits(const Char* data, Size size) noexcept {
+    /* Point is followed by at least one fractional digit */
+    auto is_fraction = (m_state == STATE_FLOATING_FRACTIONAL_FIRST);
+
+    if (!is_fraction && (m_state != STATE_INTEGRAL_NEXT)) {
+        return 0;
+    }
+
+    Size count = 0;
+
+    while (((count + floating::DIGITS_SIZE) <= size) && !m_is_truncated &&
+            (m_uint < DIGITS_LIMIT)) {
+        auto value = floating::load_digits(data + count);
+
+        if (!floating::is_eight_digits(value)) {
+            break;
+        }
+
+        m_uint = (100000000 * m_uint) + floating::eight_digits(value);
+        count += floating::DIGITS_SIZE;
+
+        if (is_fraction) {
+            m_exponent -= Int(floating::DIGITS_SIZE);
+            m_state = STATE_FLOATING_FRACTIONAL_DIGIT;
+        }
+    }
+
+    if (count) {
+        append(data, count);
+    }
+
+    return count;
+}
+
+template<typename T> void
+BasicParser<T>::number_end(char32_t ch) noexcept {
+    auto is_integral = !m_is_truncated &&
+        ((m_state == STATE_INTEGRAL_NEXT) ||
+         (m_state == STATE_FLOATING_DOT));
+
+    if (!T::NEEDS_VALUES) {
+        value_end(m_handler.number(Number{}));
+    }
+    else if (m_is_raw_numbers) {
+        auto type = m_is_decimal_numbers ? Number::DECIMAL : Number::DOUBLE;
+
+        if (is_integral && !m_is_negative) {
+            type = Number::UINT;
+        }
+        else if (is_integral && (m_uint <= INT_MAGNITUDE_MAX)) {
+            type = Number::INT;
+        }
+
+        m_is_raw_begin = false;
+        value_end(m_handler.number(Number{type, m_raw ? m_raw : m_buffer,
+                    m_buffer_length}));
+    }
+    else if (is_integral && !m_is_negative) {
+        value_end(m_handler.number(Number{m_uint}));
+    }
+    else if (is_integral && (m_uint <= INT_MAGNITUDE_MAX)) {
+        value_end(m_handler.number(Number{Int(~m_uint + 1)}));
+    }
+    else if (m_is_decimal_numbers) {
+        value_end(m_handler.number(Number{StringView{m_buffer,
+                    m_buffer_length}, *m_allocator}));
+    }
+    else {
+        auto exponent = m_exponent + (m_is_exponent_negative ?
+                -m_exponent_value : m_exponent_value);
+        Double number;
+
+        if (!floating::compute(m_uint, exponent, m_is_inexact, m_is_negative,
+                    number)) {
+            number = floating::compute(m_buffer, m_buffer_length);
+        }
+
+        value_end(m_handler.number(Number{number}));
+    }
+
+    /* Character that ended a number belongs to the next token */
+    step(ch);
+}
+
+inline auto
+Parser::value() noexcept -> Value& {
+    return m_value;
+}
+
+inline auto
+Parser::value() const noexcept -> const Value& {
+    return m_value;
+}
+
+inline auto
+Parser::parse(const Span<const Char>& data) noexcept -> Status {
+    return parse(data.data(), data.size());
+}
+
+inline auto
+Parser::parse_in_situ(Char* data, Size size) noexcept -> Status {
+    m_is_in_situ = true;
+
+    auto result = m_parser.parse_in_situ(data, size);
+
+    m_is_in_situ = false;
+
+    return result;
+}
+
+inline auto
+Parser::parse_one(const Char* data, Size size) noexcept -> Status {
+    m_is_one = true;
+
+    auto result = m_parser.parse(data, size);
+
+    m_is_one = false;
+
+    return result;
+}
+
+inline void
+Parser::restart() noexcept {
+    m_parser.restart();
+}
+
+inline void
+Parser::fail(ParseError::Code code) noexcept {
+    m_parser.fail(code);
+}
+
+inline auto
+Parser::status() const noexcept -> Status {
+    return m_parser.status();
+}
+
+inline auto
+Parser::offset() const noexcept -> Size {
+    return m_parser.offset();
+}
+
+inline auto
+Parser::error() const noexcept -> ParseError {
+    auto error = m_parser.error();
+
+    /* Values are rejected only when they can't be allocated */
+    if (ParseError::HANDLER_REJECTED == error.code()) {
+        return {ParseError::OUT_OF_MEMORY, error.offset(), error.line(),
+            error.column()};
+    }
+
+    return error;
+}
+
 inline void
-Parser::put(char32_t ch) noexcept {
-    m_decoder.decode(ch);
+Parser::set_limits(const Limits& limits) noexcept {
+    m_parser.set_limits(limits);
+}
+
+inline auto
+Parser::limits() const noexcept -> const Limits& {
+    return m_parser.limits();
+}
+
+inline void
+Parser::set_raw_numbers(bool enable) noexcept {
+    m_parser.set_raw_numbers(enable);
+}
+
+inline auto
+Parser::raw_numbers() const noexcept -> bool {
+    return m_parser.raw_numbers();
+}
+
+inline void
+Parser::set_decimal_numbers(bool enable) noexcept {
+    m_parser.set_decimal_numbers(enable);
+}
+
+inline auto
+Parser::decimal_numbers() const noexcept -> bool {
+    return m_parser.decimal_numbers();
 }
 
 }
@@ -0,0 +1,183 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/reader.hpp
+ *
+ * @brief JSON pull reader interface
+ *
+ * Reader walks a buffer token by token, next() parses only as far as
+ * the next token. String views are valid until the following next().
+ */
+
+#ifndef JSON_READER_HPP
+#define JSON_READER_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "number.hpp"
+#include "parser.hpp"
+#include "allocator.hpp"
+#include "string_view.hpp"
+
+namespace json {
+
+class Reader final : public Handler<Reader> {
+public:
+    enum TokenType {
+        NONE,
+        NIL,
+        BOOLEAN,
+        NUMBER,
+        STRING,
+        KEY,
+        START_OBJECT,
+        END_OBJECT,
+        START_ARRAY,
+        END_ARRAY
+    };
+
+    Reader(const Char* data, Size size,
+            Allocator& alloc = Allocator::get_instance()) noexcept;
+
+    explicit Reader(const Span<const Char>& data,
+            Allocator& alloc = Allocator::get_instance()) noexcept;
+
+    bool next() noexcept;
+
+    void skip_value() noexcept;
+
+    TokenType token_type() const noexcept;
+
+    Bool get_bool() const noexcept;
+
+    const Number& get_number() const noexcept;
+
+    StringView get_string_view() const noexcept;
+
+    Size depth() const noexcept;
+
+    Status status() const noexcept;
+
+    Size offset() const noexcept;
+
+    ParseError error() const noexcept;
+
+    /*! Stops with an error found outside of the input, like a codec's */
+    void fail(ParseError::Code code) noexcept;
+private:
+    friend class BasicParser<Reader>;
+
+    /* One byte can end a number and its container */
+    static constexpr Size TOKENS_SIZE{2};
+
+    struct Token {
+        TokenType type;
+        Size depth;
+    };
+
+    bool null() noexcept;
+
+    bool boolean(Bool value) noexcept;
+
+    bool number(const Number& value) noexcept;
+
+    bool string(const StringView& value) noexcept;
+
+    bool key(const StringView& value) noexcept;
+
+    bool start_object() noexcept;
+
+    bool end_object() noexcept;
+
+    bool start_array() noexcept;
+
+    bool end_array() noexcept;
+
+    bool push(TokenType type) noexcept;
+
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    const Char* m_data;
+    Size m_size;
+    Token m_tokens[TOKENS_SIZE]{};
+    Size m_tokens_first{0};
+    Size m_tokens_length{0};
+    Size m_depth{0};
+    Bool m_bool{false};
+    Number m_number{};
+    StringView m_string{};
+    bool m_is_finished{false};
+    BasicParser<Reader> m_parser;
+};
+
+inline
+Reader::Reader(const Span<const Char>& data, Allocator& alloc) noexcept :
+    Reader{data.data(), data.size(), alloc}
+{ }
+
+inline auto
+Reader::token_type() const noexcept -> TokenType {
+    return m_tokens_length ? m_tokens[m_tokens_first].type : NONE;
+}
+
+inline auto
+Reader::get_bool() const noexcept -> Bool {
+    return m_bool;
+}
+
+inline auto
+Reader::get_number() const noexcept -> const Number& {
+    return m_number;
+}
+
+inline auto
+Reader::get_string_view() const noexcept -> StringView {
+    return m_string;
+}
+
+inline auto
+Reader::depth() const noexcept -> Size {
+    return m_tokens_length ? m_tokens[m_tokens_first].depth : m_depth;
+}
+
+inline auto
+Reader::status() const noexcept -> Status {
+    return m_parser.status();
+}
+
+inline auto
+Reader::offset() const noexcept -> Size {
+    return m_parser.offset();
+}
+
+inline auto
+Reader::error() const noexcept -> ParseError {
+    return m_parser.error();
+}
+
+inline void
+Reader::fail(ParseError::Code code) noexcept {
+    m_tokens_length = 0;
+    m_parser.fail(code);
+}
+
+}
+
+#endif /* JSON_READER_HPP */
@@ -0,0 +1,112 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/scanner.hpp
+ *
+ * @brief JSON structural scanner interface
+ *
+ * Classifies input 64 bytes at a time and produces bitmaps of quotes,
+ * backslashes, brackets, structural characters, whitespaces and string
+ * interiors. Bit N of every mask describes byte N of a block. Skipping,
+ * indexing and splitting use the blocks, the parser searches only long
+ * strings with string_stops().
+ */
+
+#ifndef JSON_SCANNER_HPP
+#define JSON_SCANNER_HPP
+
+#include "types.hpp"
+
+#include <cstdint>
+
+namespace json {
+
+class Scanner {
+public:
+    using Mask = std::uint64_t;
+
+    static constexpr Size BLOCK_SIZE{64};
+
+    struct Block {
+        Mask quote;
+        Mask backslash;
+        Mask escaped;
+        Mask string;
+        Mask open;
+        Mask close;
+        Mask structural;
+        Mask whitespace;
+    };
+
+    Scanner() noexcept = default;
+
+    Scanner(bool in_string, bool escaped) noexcept;
+
+    void scan(const Char* data, Block& block) noexcept;
+
+    void scan(const Char* data, Size size, Block& block) noexcept;
+
+    /*!
+     * Quotes, backslashes, control and non-ASCII bytes of a complete
+     * block, everything else is copied from strings as it is
+     */
+    static Mask string_stops(const Char* data) noexcept;
+
+    bool in_string() const noexcept;
+
+    bool escaped() const noexcept;
+private:
+    Mask m_in_string{0};
+    Mask m_escaped{0};
+};
+
+inline
+Scanner::Scanner(bool in_string, bool escaped) noexcept :
+    m_in_string{in_string ? ~Mask(0) : Mask(0)},
+    m_escaped{escaped ? Mask(1) : Mask(0)}
+{ }
+
+inline auto
+Scanner::in_string() const noexcept -> bool {
+    return (0 != m_in_string);
+}
+
+inline auto
+Scanner::escaped() const noexcept -> bool {
+    return (0 != m_escaped);
+}
+
+static inline unsigned count_trailing_zeros(Scanner::Mask mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return unsigned(__builtin_ctzll(mask));
+#else
+    unsigned count = 0;
+
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++count;
+    }
+
+    return count;
+#endif
+}
+
+}
+
+#endif /* JSON_SCANNER_HPP */
@@ -0,0 +1,175 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/sequence_parser.hpp
+ *
+ * @brief Concatenated JSON parser interface
+ *
+ * SequenceParser walks JSON texts written back to back in one buffer,
+ * {...}{...}[...], optionally separated by whitespace. Every next() parses
+ * one document in a single pass with Parser::parse_one(), the value is
+ * replaced by the following next(). Streams fed in chunks use
+ * Parser::parse_one() and Parser::restart() directly.
+ */
+
+#ifndef JSON_SEQUENCE_PARSER_HPP
+#define JSON_SEQUENCE_PARSER_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "value.hpp"
+#include "parser.hpp"
+#include "allocator.hpp"
+
+#include <iterator>
+
+namespace json {
+
+class SequenceParser {
+public:
+    /*! Single pass input iterator, begin() parses the first document */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Value;
+        using difference_type = Difference;
+        using pointer = Value*;
+        using reference = Value&;
+
+        iterator() noexcept = default;
+
+        explicit iterator(SequenceParser* parser) noexcept;
+
+        reference operator*() const noexcept;
+
+        pointer operator->() const noexcept;
+
+        iterator& operator++() noexcept;
+
+        bool operator==(const iterator& other) const noexcept;
+
+        bool operator!=(const iterator& other) const noexcept;
+    private:
+        SequenceParser* m_parser{nullptr};
+    };
+
+    SequenceParser(const Char* data, Size size,
+            Allocator& alloc = Allocator::get_instance()) noexcept;
+
+    explicit SequenceParser(const Span<const Char>& data,
+            Allocator& alloc = Allocator::get_instance()) noexcept;
+
+    /*! Parses the next document, false at the end of input or an error */
+    bool next() noexcept;
+
+    Value& value() noexcept;
+
+    const Value& value() const noexcept;
+
+    /*! COMPLETE once all documents are parsed */
+    Status status() const noexcept;
+
+    ParseError error() const noexcept;
+
+    Size offset() const noexcept;
+
+    iterator begin() noexcept;
+
+    iterator end() noexcept;
+private:
+    SequenceParser(const SequenceParser&) = delete;
+    SequenceParser& operator=(const SequenceParser&) = delete;
+
+    const Char* m_data;
+    Size m_size;
+    Parser m_parser;
+    bool m_is_finished{false};
+};
+
+inline
+SequenceParser::iterator::iterator(SequenceParser* parser) noexcept :
+    m_parser{parser}
+{ }
+
+inline auto
+SequenceParser::iterator::operator*() const noexcept -> reference {
+    return m_parser->value();
+}
+
+inline auto
+SequenceParser::iterator::operator->() const noexcept -> pointer {
+    return &m_parser->value();
+}
+
+inline auto
+SequenceParser::iterator::operator++() noexcept -> iterator& {
+    if (!m_parser->next()) {
+        m_parser = nullptr;
+    }
+    return *this;
+}
+
+inline bool
+SequenceParser::iterator::operator==(const iterator& other) const noexcept {
+    return m_parser == other.m_parser;
+}
+
+inline bool
+SequenceParser::iterator::operator!=(const iterator& other) const noexcept {
+    return m_parser != other.m_parser;
+}
+
+inline
+SequenceParser::SequenceParser(const Span<const Char>& data,
+        Allocator& alloc) noexcept :
+    SequenceParser{data.data(), data.size(), alloc}
+{ }
+
+inline auto
+SequenceParser::value() noexcept -> Value& {
+    return m_parser.value();
+}
+
+inline auto
+SequenceParser::value() const noexcept -> const Value& {
+    return m_parser.value();
+}
+
+inline auto
+SequenceParser::error() const noexcept -> ParseError {
+    return m_parser.error();
+}
+
+inline auto
+SequenceParser::offset() const noexcept -> Size {
+    return m_parser.offset();
+}
+
+inline auto
+SequenceParser::begin() noexcept -> iterator {
+    return iterator{next() ? this : nullptr};
+}
+
+inline auto
+SequenceParser::end() noexcept -> iterator {
+    return {};
+}
+
+}
+
+#endif /* JSON_SEQUENCE_PARSER_HPP */
@@ -0,0 +1,62 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink.hpp
+ *
+ * @brief Interface
+ *
+ * Sink takes output of a Writer. The writer fills space acquired from the
+ * sink in place and commits it, sinks backed by memory are written
+ * without copies and the others pass large chunks on.
+ */
+
+#ifndef JSON_SINK_HPP
+#define JSON_SINK_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+
+namespace json {
+
+class Sink {
+public:
+    Sink() noexcept = default;
+
+    /*!
+     * Writable space of at least size bytes, as much as is at hand.
+     * Empty when the sink can't take more
+     */
+    virtual Span<Char> acquire(Size size) noexcept = 0;
+
+    /*! Takes the first size bytes of the last acquired space */
+    virtual bool commit(Size size) noexcept = 0;
+
+    /*! Passes committed output on */
+    virtual bool flush() noexcept = 0;
+
+    virtual ~Sink() noexcept;
+private:
+    Sink(const Sink&) = delete;
+    Sink& operator=(const Sink&) = delete;
+};
+
+}
+
+#endif /* JSON_SINK_HPP */
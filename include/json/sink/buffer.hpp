@@ -0,0 +1,95 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/buffer.hpp
+ *
+ * @brief Interface
+ */
+
+#ifndef JSON_SINK_BUFFER_HPP
+#define JSON_SINK_BUFFER_HPP
+
+#include "json/sink.hpp"
+#include "json/allocator.hpp"
+
+namespace json {
+namespace sink {
+
+/*! Growing buffer, doubles its capacity when it is full */
+class Buffer final : public Sink {
+public:
+    static constexpr Size INITIAL_SIZE{4096};
+
+    Buffer() noexcept;
+
+    explicit Buffer(Allocator& alloc) noexcept;
+
+    virtual Span<Char> acquire(Size size) noexcept override;
+
+    virtual bool commit(Size size) noexcept override;
+
+    virtual bool flush() noexcept override;
+
+    const Char* data() const noexcept;
+
+    Size size() const noexcept;
+
+    void clear() noexcept;
+
+    virtual ~Buffer() noexcept override;
+private:
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    Allocator* m_allocator;
+    Char* m_data{nullptr};
+    Size m_capacity{0};
+    Size m_size{0};
+};
+
+inline
+Buffer::Buffer() noexcept :
+    Buffer{Allocator::get_instance()}
+{ }
+
+inline
+Buffer::Buffer(Allocator& alloc) noexcept :
+    m_allocator{&alloc}
+{ }
+
+inline auto
+Buffer::data() const noexcept -> const Char* {
+    return m_data;
+}
+
+inline auto
+Buffer::size() const noexcept -> Size {
+    return m_size;
+}
+
+inline void
+Buffer::clear() noexcept {
+    m_size = 0;
+}
+
+}
+}
+
+#endif /* JSON_SINK_BUFFER_HPP */
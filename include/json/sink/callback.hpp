@@ -0,0 +1,61 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/callback.hpp
+ *
+ * @brief Interface
+ */
+
+#ifndef JSON_SINK_CALLBACK_HPP
+#define JSON_SINK_CALLBACK_HPP
+
+#include "json/sink/stream.hpp"
+
+namespace json {
+namespace sink {
+
+/*! Hands chunks over to a function, false from it fails the writer */
+class Callback final : public Stream {
+public:
+    using Function = bool(*)(void* context, const Char* data, Size size);
+
+    Callback(Function function, void* context) noexcept;
+
+    virtual ~Callback() noexcept override;
+private:
+    virtual bool write(const Char* data, Size size) noexcept override;
+
+    Callback(const Callback&) = delete;
+    Callback& operator=(const Callback&) = delete;
+
+    Function m_function;
+    void* m_context;
+};
+
+inline
+Callback::Callback(Function function, void* context) noexcept :
+    m_function{function},
+    m_context{context}
+{ }
+
+}
+}
+
+#endif /* JSON_SINK_CALLBACK_HPP */
@@ -0,0 +1,57 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/descriptor.hpp
+ *
+ * @brief Interface
+ */
+
+#ifndef JSON_SINK_DESCRIPTOR_HPP
+#define JSON_SINK_DESCRIPTOR_HPP
+
+#include "json/sink/stream.hpp"
+
+namespace json {
+namespace sink {
+
+/*! Writes chunks to a file descriptor, the descriptor isn't closed */
+class Descriptor final : public Stream {
+public:
+    explicit Descriptor(int fd) noexcept;
+
+    virtual ~Descriptor() noexcept override;
+private:
+    virtual bool write(const Char* data, Size size) noexcept override;
+
+    Descriptor(const Descriptor&) = delete;
+    Descriptor& operator=(const Descriptor&) = delete;
+
+    int m_fd;
+};
+
+inline
+Descriptor::Descriptor(int fd) noexcept :
+    m_fd{fd}
+{ }
+
+}
+}
+
+#endif /* JSON_SINK_DESCRIPTOR_HPP */
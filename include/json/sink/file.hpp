@@ -0,0 +1,59 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/file.hpp
+ *
+ * @brief Interface
+ */
+
+#ifndef JSON_SINK_FILE_HPP
+#define JSON_SINK_FILE_HPP
+
+#include "json/sink/stream.hpp"
+
+#include <cstdio>
+
+namespace json {
+namespace sink {
+
+/*! Writes chunks to a stdio stream, the stream isn't closed */
+class File final : public Stream {
+public:
+    explicit File(std::FILE* file) noexcept;
+
+    virtual ~File() noexcept override;
+private:
+    virtual bool write(const Char* data, Size size) noexcept override;
+
+    File(const File&) = delete;
+    File& operator=(const File&) = delete;
+
+    std::FILE* m_file;
+};
+
+inline
+File::File(std::FILE* file) noexcept :
+    m_file{file}
+{ }
+
+}
+}
+
+#endif /* JSON_SINK_FILE_HPP */
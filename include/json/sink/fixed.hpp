@@ -0,0 +1,85 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/fixed.hpp
+ *
+ * @brief Interface
+ */
+
+#ifndef JSON_SINK_FIXED_HPP
+#define JSON_SINK_FIXED_HPP
+
+#include "json/sink.hpp"
+
+namespace json {
+namespace sink {
+
+/*! Writes into a caller's buffer, fails when it is full */
+class Fixed final : public Sink {
+public:
+    Fixed(Char* data, Size size) noexcept;
+
+    virtual Span<Char> acquire(Size size) noexcept override;
+
+    virtual bool commit(Size size) noexcept override;
+
+    virtual bool flush() noexcept override;
+
+    const Char* data() const noexcept;
+
+    Size size() const noexcept;
+
+    void clear() noexcept;
+
+    virtual ~Fixed() noexcept override;
+private:
+    Fixed(const Fixed&) = delete;
+    Fixed& operator=(const Fixed&) = delete;
+
+    Char* m_data;
+    Size m_capacity;
+    Size m_size{0};
+};
+
+inline
+Fixed::Fixed(Char* data, Size size) noexcept :
+    m_data{data},
+    m_capacity{size}
+{ }
+
+inline auto
+Fixed::data() const noexcept -> const Char* {
+    return m_data;
+}
+
+inline auto
+Fixed::size() const noexcept -> Size {
+    return m_size;
+}
+
+inline void
+Fixed::clear() noexcept {
+    m_size = 0;
+}
+
+}
+}
+
+#endif /* JSON_SINK_FIXED_HPP */
@@ -0,0 +1,63 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/stream.hpp
+ *
+ * @brief Interface
+ */
+
+#ifndef JSON_SINK_STREAM_HPP
+#define JSON_SINK_STREAM_HPP
+
+#include "json/sink.hpp"
+
+namespace json {
+namespace sink {
+
+/*!
+ * Collects output in a chunk and writes it out whole. Derived sinks
+ * flush() before they are destroyed, the chunk isn't written otherwise
+ */
+class Stream : public Sink {
+public:
+    static constexpr Size CHUNK_SIZE{16384};
+
+    virtual Span<Char> acquire(Size size) noexcept override;
+
+    virtual bool commit(Size size) noexcept override;
+
+    virtual bool flush() noexcept override;
+
+    virtual ~Stream() noexcept override;
+protected:
+    Stream() noexcept = default;
+
+    virtual bool write(const Char* data, Size size) noexcept = 0;
+private:
+    bool write_chunk() noexcept;
+
+    Char m_chunk[CHUNK_SIZE]{};
+    Size m_size{0};
+};
+
+}
+}
+
+#endif /* JSON_SINK_STREAM_HPP */
@@ -114,6 +114,14 @@ public:
     template<typename InputIt>
     String& assign(InputIt first, InputIt last) noexcept;
 
+    /*!
+     * Refer to memory owned by the caller instead of copying it. Memory
+     * is copied to own allocation only when the string has to grow
+     */
+    String& borrow(pointer s, size_type count) noexcept;
+
+    bool borrowed() const noexcept;
+
     reference at(size_type pos) noexcept;
 
     const_reference at(size_type pos) const noexcept;
@@ -238,9 +246,12 @@ private:
     pointer insert(size_type index, const StringView& str,
             Function function) noexcept;
 
+    pointer reallocate(size_type count) noexcept;
+
     allocator_type* m_allocator{&Allocator::get_instance()};
     pointer m_data{nullptr};
     size_type m_size{0};
+    bool m_is_borrowed{false};
 };
 
 inline
@@ -312,7 +323,7 @@ String::operator=(const String& other) noexcept -> String& {
 
 inline auto
 String::operator=(String&& other) noexcept -> String& {
-    return assign(other);
+    return assign(std::move(other));
 }
 
 inline auto
@@ -494,6 +505,11 @@ String::crend() const noexcept -> const_reverse_iterator {
     return const_reverse_iterator(cbegin() - 1);
 }
 
+inline auto
+String::borrowed() const noexcept -> bool {
+    return m_is_borrowed;
+}
+
 inline auto
 String::empty() const noexcept -> bool {
     return (0 == m_size);
@@ -53,6 +53,8 @@ public:
     void decode(char16_t ch) noexcept;
 
     void decode(char32_t ch) noexcept;
+
+    bool idle() const noexcept;
 private:
     using StateHandler = void (Decoder::*)(char32_t ch);
 
@@ -110,6 +112,11 @@ Decoder::decode(char32_t ch) noexcept {
     (*this.*m_state)(ch);
 }
 
+inline bool
+Decoder::idle() const noexcept {
+    return (m_state == &Decoder::decode_utf8_code1);
+}
+
 }
 }
 
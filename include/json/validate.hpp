@@ -0,0 +1,116 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/validate.hpp
+ *
+ * @brief Validation interface
+ *
+ * validate() runs the parser state machine with UTF-8 checking but builds
+ * nothing. Strings aren't buffered and numbers aren't converted. The
+ * nesting stack, one bit per level, is taken from an allocator::Pool over
+ * a fixed buffer on the call stack, so nothing comes from the heap.
+ *
+ * That buffer caps nesting at VALIDATE_DEPTH_MAX levels. A deeper document
+ * fails with ParseError::DEPTH_LIMIT even when it is well-formed, parse it
+ * with a Parser when such depth is expected.
+ */
+
+#ifndef JSON_VALIDATE_HPP
+#define JSON_VALIDATE_HPP
+
+#include "span.hpp"
+#include "types.hpp"
+#include "parse_error.hpp"
+
+namespace json {
+
+static constexpr Size VALIDATE_DEPTH_MAX{16384};
+
+/*!
+ * Validation result, line and column of an error count from 1 and column
+ * counts bytes
+ */
+class Validation {
+public:
+    Validation() noexcept = default;
+
+    Validation(const ParseError& error) noexcept;
+
+    explicit operator bool() const noexcept;
+
+    bool is_valid() const noexcept;
+
+    const ParseError& error() const noexcept;
+
+    Size offset() const noexcept;
+
+    Size line() const noexcept;
+
+    Size column() const noexcept;
+private:
+    ParseError m_error{};
+};
+
+Validation validate(const Char* data, Size size) noexcept;
+
+Validation validate(const Span<const Char>& data) noexcept;
+
+inline
+Validation::Validation(const ParseError& error) noexcept :
+    m_error{error}
+{ }
+
+inline
+Validation::operator bool() const noexcept {
+    return is_valid();
+}
+
+inline auto
+Validation::is_valid() const noexcept -> bool {
+    return !m_error;
+}
+
+inline auto
+Validation::error() const noexcept -> const ParseError& {
+    return m_error;
+}
+
+inline auto
+Validation::offset() const noexcept -> Size {
+    return m_error.offset();
+}
+
+inline auto
+Validation::line() const noexcept -> Size {
+    return m_error.line();
+}
+
+inline auto
+Validation::column() const noexcept -> Size {
+    return m_error.column();
+}
+
+inline auto
+validate(const Span<const Char>& data) noexcept -> Validation {
+    return validate(data.data(), data.size());
+}
+
+}
+
+#endif /* JSON_VALIDATE_HPP */
@@ -146,8 +146,12 @@ public:
 
     const String& as_string() const noexcept;
 
+    Array& as_array() noexcept;
+
     const Array& as_array() const noexcept;
 
+    Object& as_object() noexcept;
+
     const Object& as_object() const noexcept;
 
     bool operator!() const noexcept;
@@ -397,11 +401,21 @@ Value::as_string() const noexcept -> const String&  {
     return m_string;
 }
 
+inline auto
+Value::as_array() noexcept -> Array&  {
+    return m_array;
+}
+
 inline auto
 Value::as_array() const noexcept -> const Array&  {
     return m_array;
 }
 
+inline auto
+Value::as_object() noexcept -> Object&  {
+    return m_object;
+}
+
 inline auto
 Value::as_object() const noexcept -> const Object&  {
     return m_object;
@@ -414,17 +428,17 @@ Value::operator Null() const noexcept {
 
 inline
 Value::operator Int() const noexcept {
-    return Int(m_number);
+    return is_number() ? Int(m_number) : Int(0);
 }
 
 inline
 Value::operator Uint() const noexcept {
-    return Uint(m_number);
+    return is_number() ? Uint(m_number) : Uint(0);
 }
 
 inline
 Value::operator Double() const noexcept {
-    return Double(m_number);
+    return is_number() ? Double(m_number) : Double(0);
 }
 
 inline
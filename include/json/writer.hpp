@@ -0,0 +1,122 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/writer.hpp
+ *
+ * @brief JSON serializer interface
+ *
+ * Writer serializes a Value or the events of a Handler into a Sink.
+ * Events are written as they come, nesting isn't checked. Top level
+ * values are separated by newlines. Raw numbers are written as their
+ * text, so BasicParser<Writer> with raw numbers passes documents through
+ * unchanged apart from whitespace.
+ */
+
+#ifndef JSON_WRITER_HPP
+#define JSON_WRITER_HPP
+
+#include "sink.hpp"
+#include "types.hpp"
+#include "value.hpp"
+#include "number.hpp"
+#include "parser.hpp"
+#include "string_view.hpp"
+
+namespace json {
+
+class Writer final : public Handler<Writer> {
+public:
+    explicit Writer(Sink& sink) noexcept;
+
+    bool null() noexcept;
+
+    bool boolean(Bool value) noexcept;
+
+    bool number(const Number& value) noexcept;
+
+    bool string(const StringView& value) noexcept;
+
+    bool key(const StringView& value) noexcept;
+
+    bool start_object() noexcept;
+
+    bool end_object() noexcept;
+
+    bool start_array() noexcept;
+
+    bool end_array() noexcept;
+
+    bool write(const Value& value) noexcept;
+
+    /*! Commits written output and flushes the sink */
+    bool flush() noexcept;
+
+    /*! Sink refused output, everything after it is dropped */
+    bool is_failed() const noexcept;
+
+    ~Writer() noexcept;
+private:
+    static constexpr Size NUMBER_SIZE{32};
+
+    bool reserve(Size size) noexcept;
+
+    void put(Char ch) noexcept;
+
+    void append(const Char* data, Size size) noexcept;
+
+    void separate() noexcept;
+
+    bool value_end() noexcept;
+
+    void quote(const StringView& value) noexcept;
+
+    void integer(Uint magnitude, bool is_negative) noexcept;
+
+    void floating(Double value) noexcept;
+
+    void decimal(const Number& value) noexcept;
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    Sink* m_sink;
+    Char* m_begin{nullptr};
+    Char* m_position{nullptr};
+    Char* m_end{nullptr};
+    Size m_depth{0};
+    Char m_separator{0};
+    bool m_is_failed{false};
+};
+
+inline auto
+Writer::is_failed() const noexcept -> bool {
+    return m_is_failed;
+}
+
+inline void
+Writer::put(Char ch) noexcept {
+    if ((m_position != m_end) || reserve(1)) {
+        *m_position++ = ch;
+    }
+}
+
+}
+
+#endif /* JSON_WRITER_HPP */
@@ -0,0 +1,177 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/allocator/arena.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/allocator/arena.hpp"
+
+#include <new>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+using json::allocator::Arena;
+
+struct Chunk {
+    Chunk* prev;
+    json::Size size;
+    json::Size used;
+};
+
+struct Header {
+    json::Size size;
+};
+
+static constexpr json::Size ALIGNMENT{alignof(std::max_align_t)};
+
+static inline json::Size align(json::Size size) noexcept {
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+static constexpr json::Size CHUNK_SIZE{(sizeof(Chunk) + ALIGNMENT - 1) &
+    ~(ALIGNMENT - 1)};
+
+static constexpr json::Size HEADER_SIZE{(sizeof(Header) + ALIGNMENT - 1) &
+    ~(ALIGNMENT - 1)};
+
+static inline std::uint8_t* data(Chunk* chunk) noexcept {
+    return reinterpret_cast<std::uint8_t*>(chunk) + CHUNK_SIZE;
+}
+
+static inline Header* header(const void* ptr) noexcept {
+    return reinterpret_cast<Header*>(
+            const_cast<std::uint8_t*>(static_cast<const std::uint8_t*>(ptr)) -
+            HEADER_SIZE);
+}
+
+Arena::~Arena() noexcept {
+    auto chunk = static_cast<Chunk*>(m_chunk_last);
+
+    while (chunk) {
+        auto prev = chunk->prev;
+        delete [] reinterpret_cast<std::uint8_t*>(chunk);
+        chunk = prev;
+    }
+}
+
+void* Arena::allocate(Size size) noexcept {
+    if (!size) {
+        return nullptr;
+    }
+
+    auto chunk = static_cast<Chunk*>(m_chunk_last);
+    auto required = HEADER_SIZE + align(size);
+
+    if (!chunk || ((chunk->used + required) > chunk->size)) {
+        auto chunk_size = std::max(m_chunk_size, required);
+        auto block = new (std::nothrow) std::uint8_t[CHUNK_SIZE + chunk_size];
+
+        if (!block) {
+            return nullptr;
+        }
+
+        chunk = reinterpret_cast<Chunk*>(block);
+        chunk->prev = static_cast<Chunk*>(m_chunk_last);
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        m_chunk_last = chunk;
+    }
+
+    auto ptr = data(chunk) + chunk->used + HEADER_SIZE;
+
+    header(ptr)->size = size;
+    chunk->used += required;
+    m_allocated_last = ptr;
+
+    return ptr;
+}
+
+void* Arena::reallocate(void* ptr, Size size) noexcept {
+    if (!ptr) {
+        return allocate(size);
+    }
+
+    if (!size) {
+        deallocate(ptr);
+        return nullptr;
+    }
+
+    auto chunk = static_cast<Chunk*>(m_chunk_last);
+    auto old_size = header(ptr)->size;
+
+    /* Most recent allocation grows or shrinks in place */
+    if (ptr == m_allocated_last) {
+        auto used = chunk->used - align(old_size) + align(size);
+
+        if (used <= chunk->size) {
+            chunk->used = used;
+            header(ptr)->size = size;
+            return ptr;
+        }
+    }
+    else if (size <= old_size) {
+        return ptr;
+    }
+
+    auto reallocated = allocate(size);
+
+    if (reallocated) {
+        std::copy_n(static_cast<const std::uint8_t*>(ptr),
+                std::min(old_size, size),
+                static_cast<std::uint8_t*>(reallocated));
+    }
+
+    return reallocated;
+}
+
+void Arena::deallocate(void* ptr) noexcept {
+    if (ptr && (ptr == m_allocated_last)) {
+        auto chunk = static_cast<Chunk*>(m_chunk_last);
+
+        chunk->used -= HEADER_SIZE + align(header(ptr)->size);
+        m_allocated_last = nullptr;
+    }
+}
+
+json::Size Arena::size(const void* ptr) const noexcept {
+    return ptr ? header(ptr)->size : 0;
+}
+
+void Arena::clear() noexcept {
+    auto chunk = static_cast<Chunk*>(m_chunk_last);
+
+    /* The latest chunk is kept for reuse */
+    if (chunk) {
+        auto prev = chunk->prev;
+
+        while (prev) {
+            auto next = prev->prev;
+            delete [] reinterpret_cast<std::uint8_t*>(prev);
+            prev = next;
+        }
+
+        chunk->prev = nullptr;
+        chunk->used = 0;
+    }
+
+    m_allocated_last = nullptr;
+}
@@ -0,0 +1,106 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/allocator/limited.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/allocator/limited.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+using json::allocator::Limited;
+
+struct Header {
+    json::Size size;
+};
+
+static constexpr json::Size ALIGNMENT{alignof(std::max_align_t)};
+
+static constexpr json::Size HEADER_SIZE{(sizeof(Header) + ALIGNMENT - 1) &
+    ~(ALIGNMENT - 1)};
+
+static inline Header* header(const void* ptr) noexcept {
+    return reinterpret_cast<Header*>(
+            const_cast<std::uint8_t*>(static_cast<const std::uint8_t*>(ptr)) -
+            HEADER_SIZE);
+}
+
+static inline void* data(void* block) noexcept {
+    return static_cast<std::uint8_t*>(block) + HEADER_SIZE;
+}
+
+Limited::~Limited() noexcept { }
+
+void* Limited::allocate(Size size) noexcept {
+    if (!size || (size > (m_limit - m_allocated))) {
+        return nullptr;
+    }
+
+    auto block = m_allocator->allocate(HEADER_SIZE + size);
+
+    if (!block) {
+        return nullptr;
+    }
+
+    static_cast<Header*>(block)->size = size;
+    m_allocated += size;
+
+    return data(block);
+}
+
+void* Limited::reallocate(void* ptr, Size size) noexcept {
+    if (!ptr) {
+        return allocate(size);
+    }
+
+    if (!size) {
+        deallocate(ptr);
+        return nullptr;
+    }
+
+    auto old_size = header(ptr)->size;
+
+    if ((size > old_size) && ((size - old_size) > (m_limit - m_allocated))) {
+        return nullptr;
+    }
+
+    auto block = m_allocator->reallocate(header(ptr), HEADER_SIZE + size);
+
+    if (!block) {
+        return nullptr;
+    }
+
+    static_cast<Header*>(block)->size = size;
+    m_allocated = m_allocated - old_size + size;
+
+    return data(block);
+}
+
+void Limited::deallocate(void* ptr) noexcept {
+    if (ptr) {
+        m_allocated -= header(ptr)->size;
+        m_allocator->deallocate(header(ptr));
+    }
+}
+
+json::Size Limited::size(const void* ptr) const noexcept {
+    return ptr ? header(ptr)->size : 0;
+}
@@ -47,9 +47,12 @@ Array::Array(size_type count, allocator_type& alloc) noexcept :
 }
 
 Array::~Array() noexcept {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        iterator{it}->~Value();
-        allocator().deallocate(&*it);
+    auto it = m_list.begin();
+
+    while (it != m_list.end()) {
+        auto item = it++;
+        iterator{item}->~Value();
+        allocator().deallocate(&*item);
     }
 }
 
@@ -66,6 +69,20 @@ Array& Array::operator=(Array&& other) noexcept {
     return *this;
 }
 
+void Array::splice(Array&& other) noexcept {
+    if (this != &other) {
+        if (&allocator() == &other.allocator()) {
+            m_list.splice(std::move(other.m_list));
+        }
+        else {
+            for (auto& value : other) {
+                push_back(std::move(value));
+            }
+            other.clear();
+        }
+    }
+}
+
 void Array::assign(size_type count, const value_type& value) noexcept {
     clear();
 
@@ -118,9 +135,12 @@ void Array::pop_back() noexcept {
 }
 
 void Array::clear() noexcept {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        iterator{it}->~Value();
-        allocator().deallocate(&*it);
+    auto it = m_list.begin();
+
+    while (it != m_list.end()) {
+        auto item = it++;
+        iterator{item}->~Value();
+        allocator().deallocate(&*item);
     }
     m_list.clear();
 }
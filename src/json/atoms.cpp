@@ -0,0 +1,117 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/atoms.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/atoms.hpp"
+#include "json/hash.hpp"
+
+#include <algorithm>
+
+using json::Atoms;
+
+constexpr json::Size Atoms::CAPACITY;
+
+Atoms::~Atoms() noexcept {
+    for (Size i = 0; i < m_capacity; ++i) {
+        m_allocator->deallocate(m_atoms[i].data);
+    }
+
+    m_allocator->deallocate(m_atoms);
+}
+
+/* Linear probing, capacity is a power of two and at most half full */
+auto Atoms::lookup(const StringView& str,
+        std::uint32_t hash) const noexcept -> Atom* {
+    auto mask = m_capacity - 1;
+    auto atom = &m_atoms[hash & mask];
+
+    while (atom->data && ((atom->hash != hash) || (atom->size != str.size()) ||
+                !std::equal(str.begin(), str.end(), atom->data))) {
+        atom = &m_atoms[(Size(atom - m_atoms) + 1) & mask];
+    }
+
+    return atom;
+}
+
+bool Atoms::grow() noexcept {
+    auto capacity = m_capacity ? (2 * m_capacity) : CAPACITY;
+    auto atoms = m_allocator->allocate<Atom>(capacity);
+
+    if (!atoms) {
+        return false;
+    }
+
+    std::fill_n(atoms, capacity, Atom{nullptr, 0, 0});
+
+    std::swap(atoms, m_atoms);
+    std::swap(capacity, m_capacity);
+
+    for (Size i = 0; i < capacity; ++i) {
+        if (atoms[i].data) {
+            *lookup({atoms[i].data, atoms[i].size}, atoms[i].hash) = atoms[i];
+        }
+    }
+
+    m_allocator->deallocate(atoms);
+
+    return true;
+}
+
+json::StringView Atoms::intern(const StringView& str) noexcept {
+    auto hash = key_hash(str);
+    auto atom = m_capacity ? lookup(str, hash) : nullptr;
+
+    if (!atom || !atom->data) {
+        /* Only a new atom may need room, its slot moves when grown */
+        if (2 * (m_size + 1) > m_capacity) {
+            if (!grow()) {
+                return {};
+            }
+            atom = lookup(str, hash);
+        }
+
+        /* Atoms are null terminated, empty ones get a non null address */
+        auto data = m_allocator->allocate<Char>(str.size() + 1);
+
+        if (!data) {
+            return {};
+        }
+
+        std::copy_n(str.data(), str.size(), data);
+        data[str.size()] = '\0';
+
+        *atom = {data, str.size(), hash};
+        ++m_size;
+    }
+
+    return {atom->data, atom->size};
+}
+
+json::StringView Atoms::find(const StringView& str) const noexcept {
+    if (!m_size) {
+        return {};
+    }
+
+    auto atom = lookup(str, key_hash(str));
+
+    return {atom->data, atom->size};
+}
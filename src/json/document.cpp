@@ -0,0 +1,560 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/document.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/document.hpp"
+#include "json/scanner.hpp"
+
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+using json::Document;
+using json::LazyValue;
+using json::Value;
+
+static constexpr json::Size NPOS{std::numeric_limits<json::Size>::max()};
+
+static constexpr json::Size ENTRIES_SIZE{256};
+
+static inline bool is_whitespace(json::Char ch) noexcept {
+    return (' ' == ch) || ('\t' == ch) || ('\n' == ch) || ('\r' == ch);
+}
+
+static inline bool is_delimited(json::Char ch) noexcept {
+    return ('{' == ch) || ('[' == ch) || ('"' == ch);
+}
+
+/* What may come next while indexing, separators are checked there and
+ * scalars only once they are accessed */
+enum Expect {
+    EXPECT_VALUE,
+    EXPECT_VALUE_OR_CLOSE,
+    EXPECT_KEY,
+    EXPECT_KEY_OR_CLOSE,
+    EXPECT_COLON,
+    EXPECT_SEPARATOR
+};
+
+static inline bool is_value(Expect expect) noexcept {
+    return (EXPECT_VALUE == expect) || (EXPECT_VALUE_OR_CLOSE == expect);
+}
+
+namespace {
+
+/* Materializes scalars without building a Value */
+class Scalar : public json::Handler<Scalar> {
+public:
+    explicit Scalar(json::Allocator& alloc) noexcept :
+        string_value{alloc}
+    { }
+
+    bool boolean(json::Bool value) noexcept {
+        type = Value::BOOLEAN;
+        boolean_value = value;
+        return true;
+    }
+
+    bool number(const json::Number& value) noexcept {
+        type = Value::NUMBER;
+        number_value = value;
+        return true;
+    }
+
+    bool string(const json::StringView& value) noexcept {
+        type = Value::STRING;
+        string_value.assign(value.data(), value.size());
+        return true;
+    }
+
+    Value::Type type{Value::NIL};
+    json::Bool boolean_value{false};
+    json::Number number_value{};
+    json::String string_value;
+};
+
+}
+
+static void materialize(const json::StringView& text, json::Allocator& alloc,
+        Scalar& scalar) noexcept {
+    json::BasicParser<Scalar> parser{scalar, alloc};
+
+    parser.parse(text.data(), text.size());
+
+    if (json::Status::COMPLETE != parser.finish()) {
+        scalar.type = Value::NIL;
+    }
+}
+
+Document::~Document() noexcept {
+    m_allocator->deallocate(m_entries);
+}
+
+bool Document::push(Size position) noexcept {
+    if (m_entries_length >= m_entries_size) {
+        auto size = m_entries_size ? (2 * m_entries_size) : ENTRIES_SIZE;
+        auto entries = m_allocator->reallocate(m_entries, size);
+
+        if (!entries) {
+            return false;
+        }
+
+        m_entries = entries;
+        m_entries_size = size;
+    }
+
+    m_entries[m_entries_length] = {position, m_entries_length};
+    ++m_entries_length;
+
+    return true;
+}
+
+json::Size Document::skip_whitespace(Size position) const noexcept {
+    while ((position < m_size) && is_whitespace(m_data[position])) {
+        ++position;
+    }
+
+    return position;
+}
+
+json::Status Document::parse(const Char* data, Size size) noexcept {
+    Scanner scanner;
+    Scanner::Block block;
+
+    m_data = data;
+    m_size = size;
+    m_entries_length = 0;
+    m_status = Status::ERROR;
+
+    /* Open brackets link to the enclosing one until they are matched */
+    Size open = NPOS;
+    Size quote = NPOS;
+    Expect expect = EXPECT_VALUE;
+    Scanner::Mask carry = 0;
+
+    for (Size offset = 0; offset < size; offset += Scanner::BLOCK_SIZE) {
+        scanner.scan(data + offset, size - offset, block);
+
+        auto length = size - offset;
+        auto valid = (length < Scanner::BLOCK_SIZE) ?
+            ((Scanner::Mask(1) << length) - 1) : ~Scanner::Mask(0);
+        auto quotes = block.quote & ~block.escaped;
+
+        /* Scalars aren't indexed, only their first bytes are tracked */
+        auto scalar = valid & ~(block.structural | block.whitespace |
+                block.string | quotes);
+        auto starts = scalar & ~((scalar << 1) | carry);
+        carry = scalar >> (Scanner::BLOCK_SIZE - 1);
+
+        auto mask = block.structural | quotes | starts;
+
+        while (mask) {
+            auto bit = mask & (~mask + 1);
+            auto position = offset + count_trailing_zeros(mask);
+            auto index = m_entries_length;
+
+            mask &= (mask - 1);
+
+            if (bit & starts) {
+                if (!is_value(expect)) {
+                    return m_status;
+                }
+                expect = EXPECT_SEPARATOR;
+                continue;
+            }
+
+            if (!push(position)) {
+                return m_status;
+            }
+
+            switch (data[position]) {
+            case '"':
+                if (NPOS == quote) {
+                    if (is_value(expect)) {
+                        expect = EXPECT_SEPARATOR;
+                    }
+                    else if ((EXPECT_KEY == expect) ||
+                            (EXPECT_KEY_OR_CLOSE == expect)) {
+                        expect = EXPECT_COLON;
+                    }
+                    else {
+                        return m_status;
+                    }
+                    quote = index;
+                }
+                else {
+                    m_entries[quote].match = index;
+                    quote = NPOS;
+                }
+                break;
+            case '[':
+            case '{':
+                if (!is_value(expect)) {
+                    return m_status;
+                }
+                expect = ('{' == data[position]) ? EXPECT_KEY_OR_CLOSE :
+                    EXPECT_VALUE_OR_CLOSE;
+                m_entries[index].match = open;
+                open = index;
+                break;
+            case ']':
+            case '}':
+                if ((NPOS == open) || ((data[position] - 2) !=
+                            data[m_entries[open].position]) ||
+                        ((EXPECT_SEPARATOR != expect) &&
+                         (EXPECT_VALUE_OR_CLOSE != expect) &&
+                         (EXPECT_KEY_OR_CLOSE != expect))) {
+                    return m_status;
+                }
+                expect = EXPECT_SEPARATOR;
+                m_entries[index].match = open;
+                open = m_entries[open].match;
+                m_entries[m_entries[index].match].match = index;
+                m_entries[index].match = index;
+                break;
+            case ',':
+                if ((NPOS == open) || (EXPECT_SEPARATOR != expect)) {
+                    return m_status;
+                }
+                expect = ('{' == data[m_entries[open].position]) ?
+                    EXPECT_KEY : EXPECT_VALUE;
+                break;
+            case ':':
+                if (EXPECT_COLON != expect) {
+                    return m_status;
+                }
+                expect = EXPECT_VALUE;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    auto value = root();
+
+    if ((NPOS == open) && (NPOS == quote) && (EXPECT_SEPARATOR == expect) &&
+            value.is_valid() && (skip_whitespace(value.end()) == m_size)) {
+        m_status = Status::COMPLETE;
+    }
+
+    return m_status;
+}
+
+LazyValue Document::root() const noexcept {
+    auto begin = skip_whitespace(0);
+
+    if (begin >= m_size) {
+        return {};
+    }
+
+    return {*this, begin, 0};
+}
+
+Value::Type LazyValue::type() const noexcept {
+    Value::Type value_type = Value::NIL;
+
+    if (m_document) {
+        switch (m_document->m_data[m_begin]) {
+        case '{':
+            value_type = Value::OBJECT;
+            break;
+        case '[':
+            value_type = Value::ARRAY;
+            break;
+        case '"':
+            value_type = Value::STRING;
+            break;
+        case 't':
+        case 'f':
+            value_type = Value::BOOLEAN;
+            break;
+        case 'n':
+            value_type = Value::NIL;
+            break;
+        default:
+            value_type = Value::NUMBER;
+            break;
+        }
+    }
+
+    return value_type;
+}
+
+json::Size LazyValue::end() const noexcept {
+    const auto& document = *m_document;
+
+    if (is_delimited(document.m_data[m_begin])) {
+        return document.m_entries[document.m_entries[m_entry].match]
+            .position + 1;
+    }
+
+    return (m_entry < document.m_entries_length) ?
+        document.m_entries[m_entry].position : document.m_size;
+}
+
+json::Size LazyValue::next() const noexcept {
+    if (is_delimited(m_document->m_data[m_begin])) {
+        return m_document->m_entries[m_entry].match + 1;
+    }
+
+    return m_entry;
+}
+
+LazyValue LazyValue::element(Size entry) const noexcept {
+    const auto& document = *m_document;
+
+    if (entry >= document.m_entries_length) {
+        return {};
+    }
+
+    auto begin = document.skip_whitespace(
+            document.m_entries[entry].position + 1);
+
+    if (begin >= document.m_size) {
+        return {};
+    }
+
+    auto ch = document.m_data[begin];
+
+    if ((',' == ch) || (':' == ch) || (']' == ch) || ('}' == ch)) {
+        return {};
+    }
+
+    if (is_delimited(ch) && (((entry + 1) >= document.m_entries_length) ||
+                (document.m_entries[entry + 1].position != begin))) {
+        return {};
+    }
+
+    return {document, begin, entry + 1};
+}
+
+json::StringView LazyValue::raw() const noexcept {
+    if (!m_document) {
+        return {};
+    }
+
+    return {m_document->m_data + m_begin, end() - m_begin};
+}
+
+json::Size LazyValue::size() const noexcept {
+    if (!is_array() && !is_object()) {
+        return 0;
+    }
+
+    const auto& document = *m_document;
+    const auto* entries = document.m_entries;
+    auto last = entries[m_entry].match;
+
+    if (document.skip_whitespace(entries[m_entry].position + 1) ==
+            entries[last].position) {
+        return 0;
+    }
+
+    Size count = 1;
+
+    /* Only commas of this level are counted, nested values and strings
+     * are jumped over to their closing entries */
+    for (auto entry = m_entry + 1; entry < last; ) {
+        if (entries[entry].match != entry) {
+            entry = entries[entry].match + 1;
+        }
+        else {
+            if (',' == document.m_data[entries[entry].position]) {
+                ++count;
+            }
+            ++entry;
+        }
+    }
+
+    return count;
+}
+
+LazyValue LazyValue::operator[](Size index) const noexcept {
+    if (!is_array()) {
+        return {};
+    }
+
+    const auto& document = *m_document;
+    auto value = element(m_entry);
+
+    while (index && value.is_valid()) {
+        auto entry = value.next();
+
+        if ((entry >= document.m_entries_length) ||
+                (',' != document.m_data[document.m_entries[entry].position])) {
+            return {};
+        }
+
+        value = element(entry);
+        --index;
+    }
+
+    return value;
+}
+
+LazyValue LazyValue::operator[](const StringView& key) const noexcept {
+    if (!is_object()) {
+        return {};
+    }
+
+    const auto& document = *m_document;
+    const auto* entries = document.m_entries;
+    auto entry = m_entry;
+
+    while ((entry + 1) < document.m_entries_length) {
+        auto name = LazyValue{document, entries[entry + 1].position,
+            entry + 1};
+
+        if (!name.is_string() || (document.skip_whitespace(
+                        entries[entry].position + 1) != name.m_begin)) {
+            break;
+        }
+
+        auto colon = name.next();
+
+        if ((colon >= document.m_entries_length) ||
+                (':' != document.m_data[entries[colon].position])) {
+            break;
+        }
+
+        auto value = element(colon);
+
+        if (!value.is_valid()) {
+            break;
+        }
+
+        /* Escaped names are compared after unescaping */
+        auto text = name.raw();
+        auto first = text.data() + 1;
+        auto last = text.data() + text.size() - 1;
+
+        if (std::find(first, last, '\\') == last) {
+            if ((Size(last - first) == key.size()) &&
+                    std::equal(first, last, key.data())) {
+                return value;
+            }
+        }
+        else {
+            auto string = name.as_string();
+
+            if ((string.size() == key.size()) &&
+                    std::equal(string.cbegin(), string.cend(), key.data())) {
+                return value;
+            }
+        }
+
+        entry = value.next();
+
+        if ((entry >= document.m_entries_length) ||
+                (',' != document.m_data[entries[entry].position])) {
+            break;
+        }
+    }
+
+    return {};
+}
+
+Value LazyValue::to_value() const noexcept {
+    if (!m_document) {
+        return {};
+    }
+
+    auto text = raw();
+    Parser parser{m_document->allocator()};
+
+    parser.parse(text.data(), text.size());
+
+    if (Status::COMPLETE != parser.finish()) {
+        return {};
+    }
+
+    return std::move(parser.value());
+}
+
+bool LazyValue::get(Bool& value) const noexcept {
+    Scalar scalar{allocator()};
+
+    if (is_bool()) {
+        materialize(raw(), allocator(), scalar);
+    }
+
+    if (Value::BOOLEAN != scalar.type) {
+        return false;
+    }
+
+    value = scalar.boolean_value;
+    return true;
+}
+
+bool LazyValue::get(Number& value) const noexcept {
+    Scalar scalar{allocator()};
+
+    if (is_number()) {
+        materialize(raw(), allocator(), scalar);
+    }
+
+    if (Value::NUMBER != scalar.type) {
+        return false;
+    }
+
+    value = scalar.number_value;
+    return true;
+}
+
+bool LazyValue::get(String& value) const noexcept {
+    Scalar scalar{allocator()};
+
+    if (is_string()) {
+        materialize(raw(), allocator(), scalar);
+    }
+
+    if (Value::STRING != scalar.type) {
+        return false;
+    }
+
+    value = std::move(scalar.string_value);
+    return true;
+}
+
+json::Bool LazyValue::as_bool() const noexcept {
+    Bool value{false};
+    get(value);
+    return value;
+}
+
+json::Number LazyValue::as_number() const noexcept {
+    Number value{};
+    get(value);
+    return value;
+}
+
+json::String LazyValue::as_string() const noexcept {
+    String value{allocator()};
+    get(value);
+    return value;
+}
+
+json::Allocator& LazyValue::allocator() const noexcept {
+    return m_document ? m_document->allocator() : Allocator::get_instance();
+}
@@ -0,0 +1,227 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/lines_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/lines_parser.hpp"
+#include "json/parser.hpp"
+#include "json/allocator/arena.hpp"
+
+#include <new>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+using json::LinesParser;
+using json::Value;
+
+static constexpr json::Size NO_ERROR{std::numeric_limits<json::Size>::max()};
+
+static constexpr json::Size RECORDS_SIZE{64};
+
+struct Record {
+    json::Size offset;
+    json::Size error_offset;
+    Value* value;
+};
+
+static inline bool is_blank(const json::Char* first,
+        const json::Char* last) noexcept {
+    return std::all_of(first, last, [] (json::Char ch) {
+            return (' ' == ch) || ('\t' == ch) || ('\r' == ch);
+        });
+}
+
+LinesParser::Observer::~Observer() noexcept { }
+
+LinesParser::LinesParser(Observer& observer, Order order, Size threads,
+        Size batch_size) noexcept :
+    m_observer{observer},
+    m_order{order},
+    m_threads{threads ? threads : Size(std::thread::hardware_concurrency())},
+    m_batch_size{batch_size ? batch_size : BATCH_SIZE}
+{
+    if (!m_threads) {
+        m_threads = 1;
+    }
+}
+
+void LinesParser::parse(const Char* data, Size size) noexcept {
+    std::vector<std::thread> workers;
+
+    m_data = data;
+    m_size = size;
+    m_batch = 0;
+    m_delivered_batch = 0;
+
+#if defined(__cpp_exceptions)
+    try {
+#endif
+        workers.reserve(m_threads - 1);
+
+        for (Size i = 1; i < m_threads; ++i) {
+            workers.emplace_back(&LinesParser::work, this);
+        }
+#if defined(__cpp_exceptions)
+    }
+    catch (const std::exception&) {
+        /* Threads that didn't start leave their batches to the others,
+         * at worst this one parses all of them */
+    }
+#endif
+
+    work();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void LinesParser::work() noexcept {
+    for (auto batch = m_batch++; (batch * m_batch_size) < m_size;
+            batch = m_batch++) {
+        parse(batch);
+    }
+}
+
+void LinesParser::parse(Size batch) noexcept {
+    allocator::Arena arena;
+    Allocator& allocator = arena;
+    /* One parser per batch, the arena wouldn't reclaim per line parsers */
+    Parser parser{arena};
+    Record* records = nullptr;
+    Size records_size = 0;
+    Size records_length = 0;
+    bool is_turn = (UNORDERED == m_order);
+
+    auto wait_turn = [this, batch, &is_turn] () {
+        if (!is_turn) {
+            std::unique_lock<std::mutex> lock{m_mutex};
+
+            m_delivered.wait(lock, [this, batch] () {
+                    return batch == m_delivered_batch;
+                });
+
+            is_turn = true;
+        }
+    };
+
+    auto deliver = [this, &records, &records_length] () {
+        for (Size i = 0; i < records_length; ++i) {
+            if (NO_ERROR != records[i].error_offset) {
+                m_observer.get().record_parsed(records[i].offset,
+                        records[i].error_offset);
+            }
+            else {
+                m_observer.get().record_parsed(records[i].offset,
+                        *records[i].value);
+            }
+
+            if (records[i].value) {
+                records[i].value->~Value();
+            }
+        }
+
+        records_length = 0;
+    };
+
+    auto first = batch * m_batch_size;
+    auto last = std::min(first + m_batch_size, m_size);
+
+    /* Batch owns lines that start within its range */
+    if (first) {
+        auto newline = std::find(m_data + first - 1, m_data + m_size, '\n');
+        first = Size(newline - m_data) + 1;
+    }
+
+    while (first < last) {
+        auto end = Size(std::find(m_data + first, m_data + m_size, '\n') -
+                m_data);
+
+        if (!is_blank(m_data + first, m_data + end)) {
+            Record record{first, NO_ERROR, nullptr};
+
+            parser.reset();
+            parser.parse(m_data + first, end - first);
+
+            if (Status::COMPLETE != parser.finish()) {
+                record.error_offset = first + parser.offset();
+            }
+
+            if (!is_turn && (records_length >= records_size)) {
+                auto size = records_size ? (2 * records_size) : RECORDS_SIZE;
+                auto grown = allocator.reallocate(records, size);
+
+                if (grown) {
+                    records = grown;
+                    records_size = size;
+                }
+                else {
+                    /* Out of room, earlier records are delivered and the
+                     * rest of the batch is reported as it is parsed */
+                    wait_turn();
+                    deliver();
+                }
+            }
+
+            if (is_turn) {
+                if (NO_ERROR != record.error_offset) {
+                    m_observer.get().record_parsed(record.offset,
+                            record.error_offset);
+                }
+                else {
+                    m_observer.get().record_parsed(record.offset,
+                            parser.value());
+                }
+            }
+            else {
+                record.value = allocator.allocate<Value>();
+
+                if (!record.value) {
+                    record.error_offset = first;
+                }
+                else {
+                    new (record.value) Value{std::move(parser.value())};
+                }
+
+                records[records_length++] = record;
+            }
+        }
+
+        first = end + 1;
+    }
+
+    if (ORDERED == m_order) {
+        wait_turn();
+        deliver();
+
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            ++m_delivered_batch;
+        }
+
+        m_delivered.notify_all();
+    }
+}
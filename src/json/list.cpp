@@ -43,6 +43,23 @@ void List::assign(List&& other) noexcept {
     }
 }
 
+void List::splice(List&& other) noexcept {
+    if ((this != &other) && other.m_first) {
+        other.m_first->prev = m_last;
+
+        if (m_last) {
+            m_last->next = other.m_first;
+        }
+        else {
+            m_first = other.m_first;
+        }
+
+        m_last = other.m_last;
+
+        other.clear();
+    }
+}
+
 void List::push_back(ListItem& item) noexcept {
     item.prev = m_last;
     item.next = nullptr;
@@ -0,0 +1,177 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/mapped_file.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/mapped_file.hpp"
+
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define JSON_MMAP
+#else
+#include <new>
+#include <cstdio>
+#endif
+
+using json::MappedFile;
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_is_open = other.m_is_open;
+
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_is_open = false;
+    }
+    return *this;
+}
+
+#if defined(JSON_MMAP)
+
+#if defined(MADV_HUGEPAGE)
+/* Huge pages reduce TLB misses for multi gigabyte files */
+static constexpr json::Size HUGEPAGE_SIZE{2097152};
+#endif
+
+bool MappedFile::open(const char* path) noexcept {
+    close();
+
+    auto fd = ::open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat status{};
+    auto is_stat = (0 == ::fstat(fd, &status));
+
+    /* Empty file is open, there is just nothing to map */
+    if (is_stat && (0 == status.st_size)) {
+        m_is_open = true;
+    }
+    else if (is_stat && (status.st_size > 0)) {
+        auto size = Size(status.st_size);
+
+        /* Private mapping is copy on write, in situ parsing only copies
+         * pages with escaped strings */
+        auto data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE, fd, 0);
+
+        if (MAP_FAILED != data) {
+            ::madvise(data, size, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+            if (size >= HUGEPAGE_SIZE) {
+                ::madvise(data, size, MADV_HUGEPAGE);
+            }
+#endif
+            m_data = static_cast<Char*>(data);
+            m_size = size;
+            m_is_open = true;
+        }
+    }
+
+    ::close(fd);
+
+    return is_open();
+}
+
+void MappedFile::close() noexcept {
+    if (m_data) {
+        ::munmap(m_data, m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+    m_is_open = false;
+}
+
+#else
+
+bool MappedFile::open(const char* path) noexcept {
+    close();
+
+    auto file = std::fopen(path, "rb");
+
+    if (!file) {
+        return false;
+    }
+
+    if (0 == std::fseek(file, 0, SEEK_END)) {
+        auto size = std::ftell(file);
+
+        if (0 == size) {
+            m_is_open = true;
+        }
+        else if ((size > 0) && (0 == std::fseek(file, 0, SEEK_SET))) {
+            m_data = new (std::nothrow) Char[Size(size)];
+            m_size = Size(size);
+            m_is_open = (nullptr != m_data);
+
+            if (m_data && (std::fread(m_data, 1, m_size, file) != m_size)) {
+                close();
+            }
+        }
+    }
+
+    std::fclose(file);
+
+    return is_open();
+}
+
+void MappedFile::close() noexcept {
+    delete [] m_data;
+    m_data = nullptr;
+    m_size = 0;
+    m_is_open = false;
+}
+
+#endif
+
+json::Status json::parse_file(const char* path, Parser& parser) noexcept {
+    MappedFile file{path};
+
+    if (!file.is_open()) {
+        parser.fail(ParseError::FILE_ERROR);
+        return Status::ERROR;
+    }
+
+    parser.parse(file.data(), file.size());
+
+    return parser.finish();
+}
+
+json::Status json::parse_file(MappedFile& file, Parser& parser) noexcept {
+    if (!file.is_open()) {
+        parser.fail(ParseError::FILE_ERROR);
+        return Status::ERROR;
+    }
+
+    return parser.parse_in_situ(file.data(), file.size());
+}
@@ -22,21 +22,201 @@
  * @brief Implementation
  */
 
+
 #include "json/number.hpp"
+#include "json/floating.hpp"
 
 #include <new>
 #include <cmath>
 #include <limits>
+#include <algorithm>
 
 using json::Number;
 
 static_assert(std::is_standard_layout<Number>::value,
         "json::Number is not a standard layout");
 
+using Limb = std::uint32_t;
+
+static constexpr Limb LIMB_BASE{1000000000};
+static constexpr json::Size LIMB_DIGITS{9};
+
+/* Decimals beyond these fall back to Double */
+static constexpr json::Size LIMBS_MAX{1024};
+static constexpr json::Int EXPONENT_MAX{100000};
+
+/* Sign, point, exponent mark, exponent sign and digits */
+static constexpr json::Size TEXT_EXTRA{32};
+
+/* Fractions with more leading zeros use an exponent */
+static constexpr json::Size ZEROS_MAX{6};
+
+static constexpr Limb POWERS[LIMB_DIGITS]{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+};
+
+namespace {
+
+/* Temporary array, small ones stay on the stack */
+template<typename T, json::Size N>
+class Buffer {
+public:
+    Buffer(json::Allocator& alloc, json::Size size) noexcept :
+        m_allocator{&alloc},
+        m_data{(size <= N) ? m_stack : alloc.allocate<T>(size)}
+    { }
+
+    T* data() noexcept {
+        return m_data;
+    }
+
+    ~Buffer() noexcept {
+        if (m_data != m_stack) {
+            m_allocator->deallocate(m_data);
+        }
+    }
+private:
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    json::Allocator* m_allocator;
+    T m_stack[N]{};
+    T* m_data;
+};
+
+}
+
 static inline bool is_equal(json::Double lhs, json::Double rhs) noexcept {
     return std::abs(lhs - rhs) <= std::numeric_limits<json::Double>::epsilon();
 }
 
+static json::Size trim(const Limb* limbs, json::Size size) noexcept {
+    while (size && !limbs[size - 1]) {
+        --size;
+    }
+    return size;
+}
+
+/* Multiplies by 10 to the shift, output needs size + shift / 9 + 1 limbs */
+static json::Size scale(const Limb* limbs, json::Size size, json::Size shift,
+        Limb* output) noexcept {
+    auto offset = shift / LIMB_DIGITS;
+    std::uint64_t factor = POWERS[shift % LIMB_DIGITS];
+    std::uint64_t carry = 0;
+
+    std::fill_n(output, offset, Limb(0));
+
+    for (json::Size i = 0; i < size; ++i) {
+        auto value = (factor * limbs[i]) + carry;
+        output[offset + i] = Limb(value % LIMB_BASE);
+        carry = value / LIMB_BASE;
+    }
+
+    output[offset + size] = Limb(carry);
+
+    return trim(output, offset + size + 1);
+}
+
+static int compare_limbs(const Limb* lhs, json::Size lhs_size,
+        const Limb* rhs, json::Size rhs_size) noexcept {
+    if (lhs_size != rhs_size) {
+        return (lhs_size < rhs_size) ? -1 : 1;
+    }
+
+    for (auto i = lhs_size; i > 0; --i) {
+        if (lhs[i - 1] != rhs[i - 1]) {
+            return (lhs[i - 1] < rhs[i - 1]) ? -1 : 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Output needs the larger size + 1 limbs */
+static json::Size add_limbs(const Limb* lhs, json::Size lhs_size,
+        const Limb* rhs, json::Size rhs_size, Limb* output) noexcept {
+    auto size = std::max(lhs_size, rhs_size);
+    Limb carry = 0;
+
+    for (json::Size i = 0; i < size; ++i) {
+        Limb value = carry + ((i < lhs_size) ? lhs[i] : 0) +
+            ((i < rhs_size) ? rhs[i] : 0);
+        carry = (value >= LIMB_BASE) ? 1 : 0;
+        output[i] = value - (carry * LIMB_BASE);
+    }
+
+    output[size] = carry;
+
+    return trim(output, size + 1);
+}
+
+/* Lhs must not be less than rhs, output needs lhs_size limbs */
+static json::Size subtract_limbs(const Limb* lhs, json::Size lhs_size,
+        const Limb* rhs, json::Size rhs_size, Limb* output) noexcept {
+    Limb borrow = 0;
+
+    for (json::Size i = 0; i < lhs_size; ++i) {
+        Limb value = borrow + ((i < rhs_size) ? rhs[i] : 0);
+
+        if (lhs[i] >= value) {
+            output[i] = lhs[i] - value;
+            borrow = 0;
+        }
+        else {
+            output[i] = (lhs[i] + LIMB_BASE) - value;
+            borrow = 1;
+        }
+    }
+
+    return trim(output, lhs_size);
+}
+
+/* Output needs lhs_size + rhs_size limbs */
+static json::Size multiply_limbs(const Limb* lhs, json::Size lhs_size,
+        const Limb* rhs, json::Size rhs_size, Limb* output) noexcept {
+    std::fill_n(output, lhs_size + rhs_size, Limb(0));
+
+    for (json::Size i = 0; i < lhs_size; ++i) {
+        std::uint64_t carry = 0;
+
+        for (json::Size j = 0; j < rhs_size; ++j) {
+            auto value = output[i + j] +
+                (std::uint64_t(lhs[i]) * rhs[j]) + carry;
+            output[i + j] = Limb(value % LIMB_BASE);
+            carry = value / LIMB_BASE;
+        }
+
+        output[i + rhs_size] = Limb(carry);
+    }
+
+    return trim(output, lhs_size + rhs_size);
+}
+
+/* Out of memory fallback, only the leading limbs count */
+static json::Double approximate(const Limb* limbs, json::Size size,
+        json::Int exponent, bool is_negative) noexcept {
+    json::Double value = 0.0;
+
+    for (auto i = size; i > 0; --i) {
+        value = (value * LIMB_BASE) + limbs[i - 1];
+    }
+
+    value *= std::pow(10.0, json::Double(exponent));
+
+    return is_negative ? -value : value;
+}
+
+static json::Size write_int(json::Int value, json::Char* output) noexcept {
+    auto magnitude = (value < 0) ? (~json::Uint(value) + 1) : json::Uint(value);
+    json::Size length = 0;
+
+    if (value < 0) {
+        output[length++] = '-';
+    }
+
+    return length + json::floating::format(magnitude, output + length);
+}
+
 bool Number::operator!() const noexcept {
     return (*this == Number());
 }
@@ -54,12 +234,360 @@ Number::Number(Type value) noexcept :
     case DOUBLE:
         new (&m_double) Double{0.0};
         break;
+    case DECIMAL:
+        new (&m_decimal) Decimal{};
+        break;
     default:
         break;
     }
 }
 
+Number::Number(const StringView& text, Allocator& alloc) noexcept :
+    Number{DECIMAL}
+{
+    const auto* data = text.data();
+    auto size = text.size();
+    Size i = 0;
+    auto is_negative = (size > 0) && ('-' == data[0]);
+
+    if (is_negative) {
+        ++i;
+    }
+
+    auto begin = i;
+    Size count = 0;
+    Size leading = 0;
+    Size fraction = 0;
+    auto is_fraction = false;
+
+    for (; i < size; ++i) {
+        auto ch = data[i];
+
+        if (('0' <= ch) && (ch <= '9')) {
+            if ((count == leading) && ('0' == ch)) {
+                ++leading;
+            }
+            ++count;
+            if (is_fraction) {
+                ++fraction;
+            }
+        }
+        else if (('.' == ch) && !is_fraction) {
+            is_fraction = true;
+        }
+        else {
+            break;
+        }
+    }
+
+    auto end = i;
+    Int exponent = 0;
+
+    if ((i < size) && (('e' == data[i]) || ('E' == data[i]))) {
+        auto is_exponent_negative = ((i + 1) < size) && ('-' == data[i + 1]);
+
+        if (((i + 1) < size) && (('-' == data[i + 1]) || ('+' == data[i + 1]))) {
+            ++i;
+        }
+
+        for (++i; (i < size) && ('0' <= data[i]) && (data[i] <= '9'); ++i) {
+            if (exponent <= EXPONENT_MAX) {
+                exponent = (10 * exponent) + Int(data[i] - '0');
+            }
+        }
+
+        if (is_exponent_negative) {
+            exponent = -exponent;
+        }
+    }
+
+    exponent -= Int(fraction);
+
+    auto significant = count - leading;
+    auto limbs_size = (significant + LIMB_DIGITS - 1) / LIMB_DIGITS;
+
+    if ((limbs_size > LIMBS_MAX) || (exponent > EXPONENT_MAX) ||
+            (exponent < -EXPONENT_MAX)) {
+        *this = floating::compute(data, size);
+        return;
+    }
+
+    Buffer<Limb, INLINE_LIMBS> limbs{alloc, limbs_size};
+
+    if (!limbs.data()) {
+        *this = floating::compute(data, size);
+        return;
+    }
+
+    std::fill_n(limbs.data(), limbs_size, Limb(0));
+
+    /* Digits from the least significant one, leading zeros are left out */
+    for (Size position = end, k = 0; (position > begin) && (k < significant);
+            --position) {
+        auto ch = data[position - 1];
+
+        if ('.' != ch) {
+            limbs.data()[k / LIMB_DIGITS] +=
+                Limb(ch - '0') * POWERS[k % LIMB_DIGITS];
+            ++k;
+        }
+    }
+
+    *this = decimal(alloc, limbs.data(), limbs_size, exponent, is_negative);
+}
+
+Number Number::decimal(Allocator& alloc, const Limb* limbs, Size size,
+        Int exponent, bool is_negative) noexcept {
+    size = trim(limbs, size);
+
+    if ((size > LIMBS_MAX) || (exponent > EXPONENT_MAX) ||
+            (exponent < -EXPONENT_MAX)) {
+        return approximate(limbs, size, exponent, is_negative);
+    }
+
+    Number number{DECIMAL};
+    Limb* output = number.m_decimal.digits;
+
+    if (size > INLINE_LIMBS) {
+        output = alloc.allocate<Limb>(size);
+
+        if (!output) {
+            return approximate(limbs, size, exponent, is_negative);
+        }
+
+        number.m_decimal.heap = Heap{&alloc, output};
+    }
+
+    std::copy_n(limbs, size, output);
+    number.m_decimal.exponent = std::int32_t(exponent);
+    number.m_decimal.size = std::uint16_t(size);
+    number.m_decimal.is_negative = is_negative && (size > 0);
+
+    return number;
+}
+
+Number Number::decimal() const noexcept {
+    if (m_is_raw) {
+        return converted().decimal();
+    }
+
+    Number number{DECIMAL};
+
+    if (DECIMAL == type()) {
+        number = *this;
+    }
+    else if (is_integral()) {
+        auto is_negative = (INT == type()) && (m_int < 0);
+        Uint magnitude = is_negative ? (~Uint(m_int) + 1) : Uint(*this);
+        Limb limbs[3]{
+            Limb(magnitude % LIMB_BASE),
+            Limb((magnitude / LIMB_BASE) % LIMB_BASE),
+            Limb(magnitude / LIMB_BASE / LIMB_BASE)
+        };
+
+        number = decimal(Allocator::get_instance(), limbs, 3, 0, is_negative);
+    }
+
+    return number;
+}
+
+auto Number::limbs() const noexcept -> const Limb* {
+    return is_heap() ? m_decimal.heap.limbs : m_decimal.digits;
+}
+
+auto Number::allocator() const noexcept -> Allocator* {
+    return is_heap() ? m_decimal.heap.allocator : &Allocator::get_instance();
+}
+
+Number::~Number() noexcept {
+    if (is_heap()) {
+        release();
+    }
+}
+
+void Number::release() noexcept {
+    m_decimal.heap.allocator->deallocate(m_decimal.heap.limbs);
+    m_type = INT;
+    m_int = 0;
+}
+
+void Number::copy_heap(const Number& other) noexcept {
+    auto& alloc = *other.m_decimal.heap.allocator;
+    auto* limbs = alloc.allocate<Limb>(m_decimal.size);
+
+    if (limbs) {
+        std::copy_n(other.m_decimal.heap.limbs, m_decimal.size, limbs);
+        m_decimal.heap.limbs = limbs;
+    }
+    else {
+        /* Limbs still belong to other */
+        m_type = DOUBLE;
+        m_double = approximate(other.m_decimal.heap.limbs,
+                other.m_decimal.size, other.m_decimal.exponent,
+                other.m_decimal.is_negative);
+    }
+}
+
+auto Number::digits(Char* buffer) const noexcept -> Size {
+    const auto* data = limbs();
+    Size size = m_decimal.size;
+    Size length = 0;
+
+    if (!size) {
+        buffer[length++] = '0';
+    }
+
+    for (auto i = size; i > 0; --i) {
+        Char text[LIMB_DIGITS];
+        auto limb = data[i - 1];
+
+        for (auto j = LIMB_DIGITS; j > 0; --j) {
+            text[j - 1] = Char('0' + (limb % 10));
+            limb /= 10;
+        }
+
+        /* Only the leading limb isn't padded with zeros */
+        Size first = 0;
+        if (i == size) {
+            while ((first < (LIMB_DIGITS - 1)) && ('0' == text[first])) {
+                ++first;
+            }
+        }
+
+        length = Size(std::copy(text + first, text + LIMB_DIGITS,
+                    buffer + length) - buffer);
+    }
+
+    return length;
+}
+
+auto Number::to_double() const noexcept -> Double {
+    Buffer<Char, 128> text{*allocator(),
+        (LIMB_DIGITS * m_decimal.size) + TEXT_EXTRA};
+
+    if (!text.data()) {
+        return approximate(limbs(), m_decimal.size, m_decimal.exponent,
+                m_decimal.is_negative);
+    }
+
+    Size length = 0;
+
+    if (m_decimal.is_negative) {
+        text.data()[length++] = '-';
+    }
+
+    length += digits(text.data() + length);
+    text.data()[length++] = 'e';
+    length += write_int(m_decimal.exponent, text.data() + length);
+
+    return floating::compute(text.data(), length);
+}
+
+/* Integral part of the magnitude, saturated when it doesn't fit */
+auto Number::to_uint() const noexcept -> Uint {
+    Buffer<Char, 128> text{*allocator(), LIMB_DIGITS * m_decimal.size + 1};
+    auto integral = Int(LIMB_DIGITS * m_decimal.size) + m_decimal.exponent;
+
+    if (!text.data() || (integral > std::numeric_limits<Uint>::digits10)) {
+        return std::numeric_limits<Uint>::max();
+    }
+
+    auto count = digits(text.data());
+    integral = Int(count) + m_decimal.exponent;
+
+    if (integral > std::numeric_limits<Uint>::digits10) {
+        return std::numeric_limits<Uint>::max();
+    }
+
+    Uint value = 0;
+
+    for (Int i = 0; i < integral; ++i) {
+        value *= 10;
+        if (Size(i) < count) {
+            value += Uint(text.data()[i] - '0');
+        }
+    }
+
+    return value;
+}
+
+auto Number::decimal_text(Char* buffer, Size size) const noexcept -> Size {
+    if (m_is_raw) {
+        if (m_raw.size <= size) {
+            std::copy_n(m_raw.data, m_raw.size, buffer);
+        }
+        return m_raw.size;
+    }
+
+    if (DECIMAL != type()) {
+        return 0;
+    }
+
+    Buffer<Char, 128> text{*allocator(), LIMB_DIGITS * m_decimal.size + 1};
+
+    if (!text.data()) {
+        return 0;
+    }
+
+    auto count = digits(text.data());
+    auto exponent = Int(m_decimal.exponent);
+    auto length = m_decimal.is_negative ? count + 1 : count;
+    Size zeros = 0;
+    Size point = 0;
+    auto is_exponent = false;
+
+    if ((exponent < 0) && (Size(-exponent) < count)) {
+        point = count - Size(-exponent);
+        ++length;
+    }
+    else if ((exponent < 0) && ((Size(-exponent) - count) <= ZEROS_MAX)) {
+        zeros = Size(-exponent) - count;
+        length += 2 + zeros;
+    }
+    else if (exponent) {
+        Char exponent_text[24];
+        length += 1 + write_int(exponent, exponent_text);
+        is_exponent = true;
+    }
+
+    if (length > size) {
+        return length;
+    }
+
+    auto* output = buffer;
+
+    if (m_decimal.is_negative) {
+        *output++ = '-';
+    }
+
+    if (point) {
+        output = std::copy_n(text.data(), point, output);
+        *output++ = '.';
+        output = std::copy(text.data() + point, text.data() + count, output);
+    }
+    else if (exponent < 0 && !is_exponent) {
+        *output++ = '0';
+        *output++ = '.';
+        output = std::fill_n(output, zeros, '0');
+        output = std::copy_n(text.data(), count, output);
+    }
+    else {
+        output = std::copy_n(text.data(), count, output);
+
+        if (is_exponent) {
+            *output++ = 'e';
+            output += write_int(exponent, output);
+        }
+    }
+
+    return Size(output - buffer);
+}
+
 Number::operator Int() const noexcept {
+    if (m_is_raw) {
+        return Int(converted());
+    }
+
     Int value = 0;
 
     switch (type()) {
@@ -72,6 +600,9 @@ Number::operator Int() const noexcept {
     case DOUBLE:
         value = Int(m_double);
         break;
+    case DECIMAL:
+        value = m_decimal.is_negative ? Int(~to_uint() + 1) : Int(to_uint());
+        break;
     default:
         break;
     }
@@ -80,6 +611,10 @@ Number::operator Int() const noexcept {
 }
 
 Number::operator Uint() const noexcept {
+    if (m_is_raw) {
+        return Uint(converted());
+    }
+
     Uint value = 0;
 
     switch (type()) {
@@ -92,6 +627,9 @@ Number::operator Uint() const noexcept {
     case DOUBLE:
         value = Uint(m_double);
         break;
+    case DECIMAL:
+        value = m_decimal.is_negative ? (~to_uint() + 1) : to_uint();
+        break;
     default:
         break;
     }
@@ -100,6 +638,10 @@ Number::operator Uint() const noexcept {
 }
 
 Number::operator Double() const noexcept {
+    if (m_is_raw) {
+        return Double(converted());
+    }
+
     Double value = 0;
 
     switch (type()) {
@@ -112,6 +654,9 @@ Number::operator Double() const noexcept {
     case DOUBLE:
         value = m_double;
         break;
+    case DECIMAL:
+        value = to_double();
+        break;
     default:
         break;
     }
@@ -119,12 +664,161 @@ Number::operator Double() const noexcept {
     return value;
 }
 
+Number Number::converted(Allocator& alloc) const noexcept {
+    if (!m_is_raw) {
+        return *this;
+    }
+
+    if (DECIMAL == type()) {
+        return Number{raw(), alloc};
+    }
+
+    if (DOUBLE == type()) {
+        return floating::compute(m_raw.data, m_raw.size);
+    }
+
+    auto is_negative = (m_raw.size > 0) && ('-' == m_raw.data[0]);
+    Uint magnitude = 0;
+
+    for (Size i = is_negative ? 1 : 0; i < m_raw.size; ++i) {
+        magnitude = (10 * magnitude) + Uint(m_raw.data[i] - '0');
+    }
+
+    if (UINT == type()) {
+        return magnitude;
+    }
+
+    return is_negative ? Int(~magnitude + 1) : Int(magnitude);
+}
+
+int Number::compare(const Number& lhs, const Number& rhs) noexcept {
+    Number lhs_decimal;
+    Number rhs_decimal;
+    const auto& a = (lhs.is_decimal() && !lhs.is_raw()) ?
+        lhs : (lhs_decimal = lhs.decimal());
+    const auto& b = (rhs.is_decimal() && !rhs.is_raw()) ?
+        rhs : (rhs_decimal = rhs.decimal());
+
+    if (!a.m_decimal.size && !b.m_decimal.size) {
+        return 0;
+    }
+
+    if (a.m_decimal.is_negative != b.m_decimal.is_negative) {
+        return a.m_decimal.is_negative ? -1 : 1;
+    }
+
+    auto exponent = std::min(a.m_decimal.exponent, b.m_decimal.exponent);
+    auto a_shift = Size(a.m_decimal.exponent - exponent);
+    auto b_shift = Size(b.m_decimal.exponent - exponent);
+    auto a_size = a.m_decimal.size + (a_shift / LIMB_DIGITS) + 1;
+    auto b_size = b.m_decimal.size + (b_shift / LIMB_DIGITS) + 1;
+
+    Buffer<Limb, 2 * INLINE_LIMBS> a_limbs{*a.allocator(),
+        (a_size <= LIMBS_MAX) ? a_size : 0};
+    Buffer<Limb, 2 * INLINE_LIMBS> b_limbs{*b.allocator(),
+        (b_size <= LIMBS_MAX) ? b_size : 0};
+
+    /* Far apart exponents aren't aligned */
+    if ((a_size > LIMBS_MAX) || (b_size > LIMBS_MAX) ||
+            !a_limbs.data() || !b_limbs.data()) {
+        auto x = a.to_double();
+        auto y = b.to_double();
+        return (x < y) ? -1 : ((y < x) ? 1 : 0);
+    }
+
+    a_size = scale(a.limbs(), a.m_decimal.size, a_shift, a_limbs.data());
+    b_size = scale(b.limbs(), b.m_decimal.size, b_shift, b_limbs.data());
+
+    auto result = compare_limbs(a_limbs.data(), a_size, b_limbs.data(),
+            b_size);
+
+    return a.m_decimal.is_negative ? -result : result;
+}
+
+Number Number::add(const Number& lhs, const Number& rhs,
+        bool is_subtraction) noexcept {
+    Number lhs_decimal;
+    Number rhs_decimal;
+    const auto& a = (lhs.is_decimal() && !lhs.is_raw()) ?
+        lhs : (lhs_decimal = lhs.decimal());
+    const auto& b = (rhs.is_decimal() && !rhs.is_raw()) ?
+        rhs : (rhs_decimal = rhs.decimal());
+    auto& alloc = a.is_heap() ? *a.allocator() : *b.allocator();
+
+    auto exponent = std::min(a.m_decimal.exponent, b.m_decimal.exponent);
+    auto a_shift = Size(a.m_decimal.exponent - exponent);
+    auto b_shift = Size(b.m_decimal.exponent - exponent);
+    auto a_size = a.m_decimal.size + (a_shift / LIMB_DIGITS) + 1;
+    auto b_size = b.m_decimal.size + (b_shift / LIMB_DIGITS) + 1;
+    auto size = std::max(a_size, b_size) + 1;
+    auto is_aligned = (a_size <= LIMBS_MAX) && (b_size <= LIMBS_MAX);
+
+    Buffer<Limb, 2 * INLINE_LIMBS> a_limbs{alloc, is_aligned ? a_size : 0};
+    Buffer<Limb, 2 * INLINE_LIMBS> b_limbs{alloc, is_aligned ? b_size : 0};
+    Buffer<Limb, 2 * INLINE_LIMBS> output{alloc, is_aligned ? size : 0};
+
+    if (!is_aligned || !a_limbs.data() || !b_limbs.data() || !output.data()) {
+        return is_subtraction ? (a.to_double() - b.to_double()) :
+            (a.to_double() + b.to_double());
+    }
+
+    a_size = scale(a.limbs(), a.m_decimal.size, a_shift, a_limbs.data());
+    b_size = scale(b.limbs(), b.m_decimal.size, b_shift, b_limbs.data());
+
+    auto is_negative = a.m_decimal.is_negative;
+    auto is_b_negative = (b.m_decimal.is_negative != is_subtraction);
+
+    if (is_negative == is_b_negative) {
+        size = add_limbs(a_limbs.data(), a_size, b_limbs.data(), b_size,
+                output.data());
+    }
+    else if (compare_limbs(a_limbs.data(), a_size, b_limbs.data(),
+                b_size) >= 0) {
+        size = subtract_limbs(a_limbs.data(), a_size, b_limbs.data(), b_size,
+                output.data());
+    }
+    else {
+        size = subtract_limbs(b_limbs.data(), b_size, a_limbs.data(), a_size,
+                output.data());
+        is_negative = is_b_negative;
+    }
+
+    return decimal(alloc, output.data(), size, exponent, is_negative);
+}
+
+Number Number::multiply(const Number& lhs, const Number& rhs) noexcept {
+    Number lhs_decimal;
+    Number rhs_decimal;
+    const auto& a = (lhs.is_decimal() && !lhs.is_raw()) ?
+        lhs : (lhs_decimal = lhs.decimal());
+    const auto& b = (rhs.is_decimal() && !rhs.is_raw()) ?
+        rhs : (rhs_decimal = rhs.decimal());
+    auto& alloc = a.is_heap() ? *a.allocator() : *b.allocator();
+
+    Size size = a.m_decimal.size + b.m_decimal.size;
+    Buffer<Limb, 2 * INLINE_LIMBS> output{alloc, size};
+
+    if (!output.data()) {
+        return a.to_double() * b.to_double();
+    }
+
+    size = multiply_limbs(a.limbs(), a.m_decimal.size, b.limbs(),
+            b.m_decimal.size, output.data());
+
+    return decimal(alloc, output.data(), size,
+            Int(a.m_decimal.exponent) + b.m_decimal.exponent,
+            a.m_decimal.is_negative != b.m_decimal.is_negative);
+}
+
 Number Number::operator+(const Number& other) const noexcept {
     Number value;
 
     if ((DOUBLE == type()) || (DOUBLE == other.type())) {
         value = Double(*this) + Double(other);
     }
+    else if ((DECIMAL == type()) || (DECIMAL == other.type())) {
+        value = add(*this, other, false);
+    }
     else if ((INT == type()) || (INT == other.type())) {
         value = Int(*this) + Int(other);
     }
@@ -141,6 +835,9 @@ Number Number::operator-(const Number& other) const noexcept {
     if ((DOUBLE == type()) || (DOUBLE == other.type())) {
         value = Double(*this) - Double(other);
     }
+    else if ((DECIMAL == type()) || (DECIMAL == other.type())) {
+        value = add(*this, other, true);
+    }
     else if ((INT == type()) || (INT == other.type())) {
         value = Int(*this) - Int(other);
     }
@@ -157,6 +854,9 @@ Number Number::operator*(const Number& other) const noexcept {
     if ((DOUBLE == type()) || (DOUBLE == other.type())) {
         value = Double(*this) * Double(other);
     }
+    else if ((DECIMAL == type()) || (DECIMAL == other.type())) {
+        value = multiply(*this, other);
+    }
     else if ((INT == type()) || (INT == other.type())) {
         value = Int(*this) * Int(other);
     }
@@ -167,11 +867,13 @@ Number Number::operator*(const Number& other) const noexcept {
     return value;
 }
 
+/* Quotients of decimals are rarely exact, they are computed in Double */
 Number Number::operator/(const Number& other) const noexcept {
     Number value;
 
     if (other) {
-        if ((DOUBLE == type()) || (DOUBLE == other.type())) {
+        if ((DOUBLE == type()) || (DOUBLE == other.type()) ||
+                (DECIMAL == type()) || (DECIMAL == other.type())) {
             value = Double(*this) / Double(other);
         }
         else if ((INT == type()) || (INT == other.type())) {
@@ -189,7 +891,8 @@ Number Number::operator%(const Number& other) const noexcept {
     Number value;
 
     if (other) {
-        if ((DOUBLE == type()) || (DOUBLE == other.type())) {
+        if ((DOUBLE == type()) || (DOUBLE == other.type()) ||
+                (DECIMAL == type()) || (DECIMAL == other.type())) {
             value = std::fmod(Double(*this), Double(other));
         }
         else if ((INT == type()) || (INT == other.type())) {
@@ -209,6 +912,9 @@ bool Number::operator==(const Number& other) const noexcept {
     if ((DOUBLE == type()) || (DOUBLE == other.type())) {
         value = is_equal(Double(*this), Double(other));
     }
+    else if ((DECIMAL == type()) || (DECIMAL == other.type())) {
+        value = (0 == compare(*this, other));
+    }
     else if ((INT == type()) || (INT == other.type())) {
         value = Int(*this) == Int(other);
     }
@@ -225,6 +931,9 @@ bool Number::operator<(const Number& other) const noexcept {
     if ((DOUBLE == type()) || (DOUBLE == other.type())) {
         value = Double(*this) < Double(other);
     }
+    else if ((DECIMAL == type()) || (DECIMAL == other.type())) {
+        value = (compare(*this, other) < 0);
+    }
     else if ((INT == type()) || (INT == other.type())) {
         value = Int(*this) < Int(other);
     }
@@ -47,9 +47,12 @@ Object::Object(size_type count, allocator_type& alloc) noexcept :
 }
 
 Object::~Object() noexcept {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        iterator{it}->~Pair();
-        allocator().deallocate(&*it);
+    auto it = m_list.begin();
+
+    while (it != m_list.end()) {
+        auto item = it++;
+        iterator{item}->~Pair();
+        allocator().deallocate(&*item);
     }
 }
 
@@ -118,9 +121,12 @@ void Object::pop_back() noexcept {
 }
 
 void Object::clear() noexcept {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        iterator{it}->~Pair();
-        allocator().deallocate(&*it);
+    auto it = m_list.begin();
+
+    while (it != m_list.end()) {
+        auto item = it++;
+        iterator{item}->~Pair();
+        allocator().deallocate(&*item);
     }
     m_list.clear();
 }
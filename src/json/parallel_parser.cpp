@@ -0,0 +1,230 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/parallel_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/parallel_parser.hpp"
+#include "json/scanner.hpp"
+
+#include <new>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+using json::ParallelParser;
+using json::Value;
+
+namespace {
+
+struct Range {
+    json::Size begin{0};
+    json::Size end{0};
+    json::Size content{0};
+    json::Status status{json::Status::NEED_MORE};
+    json::Size offset{0};
+    Value value{};
+};
+
+}
+
+static inline bool is_whitespace(json::Char ch) noexcept {
+    return (' ' == ch) || ('\t' == ch) || ('\n' == ch) || ('\r' == ch);
+}
+
+/* Finds commas between items of the top-level array that follow targets */
+static void split(const json::Char* data, json::Size size,
+        json::Size first, std::vector<json::Size>& commas,
+        json::Size count) noexcept {
+    json::Scanner scanner;
+    json::Scanner::Block block;
+    json::Size depth = 0;
+    json::Size target = size / count;
+
+    for (auto offset = first; offset < size;
+            offset += json::Scanner::BLOCK_SIZE) {
+        scanner.scan(data + offset, size - offset, block);
+
+        for (auto bits = block.structural; bits; bits &= (bits - 1)) {
+            auto position = offset + json::count_trailing_zeros(bits);
+
+            switch (data[position]) {
+            case '[':
+            case '{':
+                ++depth;
+                break;
+            case ']':
+            case '}':
+                if (0 == --depth) {
+                    return;
+                }
+                break;
+            case ',':
+                if ((1 == depth) && (position >= target)) {
+                    commas.push_back(position);
+
+                    if (commas.size() + 1 >= count) {
+                        return;
+                    }
+
+                    target = (commas.size() + 1) * size / count;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+static void parse_range(json::Allocator& alloc, const json::Char* data,
+        Range& range, bool is_first, bool is_last) noexcept {
+    json::Parser parser{alloc};
+    json::Size skew = 0;
+
+    if (!is_first) {
+        parser.put('[');
+        skew = 1;
+    }
+
+    parser.parse(data + range.begin, range.end - range.begin);
+
+    if (!is_last) {
+        parser.put(']');
+    }
+
+    range.status = parser.finish();
+    range.offset = range.begin + parser.offset() - skew;
+
+    if (json::Status::COMPLETE == range.status) {
+        range.value = std::move(parser.value());
+
+        /* An empty range means two commas or a comma at an array end */
+        if (range.value.as_array().empty()) {
+            auto it = std::find_if_not(data + range.content, data + range.end,
+                    is_whitespace);
+
+            range.status = json::Status::ERROR;
+            range.offset = json::Size(it - data);
+        }
+    }
+}
+
+ParallelParser::ParallelParser(Size threads, Size range_size) noexcept :
+    ParallelParser{Allocator::get_instance(), threads, range_size}
+{
+    m_arenas.reset(new (std::nothrow) allocator::Arena[m_threads]);
+
+    /* Without arenas threads share the default allocator */
+    if (m_arenas) {
+        m_allocator = nullptr;
+    }
+}
+
+ParallelParser::ParallelParser(Allocator& alloc, Size threads,
+        Size range_size) noexcept :
+    m_allocator{&alloc},
+    m_threads{threads ? threads :
+        std::max(Size(std::thread::hardware_concurrency()), Size(1))},
+    m_range_size{range_size ? range_size : RANGE_SIZE},
+    m_value{Value::NIL, alloc}
+{ }
+
+ParallelParser::~ParallelParser() noexcept { }
+
+json::Allocator& ParallelParser::allocator(Size thread) noexcept {
+    return m_allocator ? *m_allocator : m_arenas[thread];
+}
+
+json::Status ParallelParser::parse(const Char* data, Size size) noexcept {
+    if (m_arenas) {
+        /* Previous values are released with their arenas */
+        m_value = Value{};
+
+        for (Size i = 0; i < m_threads; ++i) {
+            m_arenas[i].clear();
+        }
+    }
+
+    std::vector<Size> commas;
+    auto count = std::min(m_threads, size / m_range_size);
+    auto first = Size(std::find_if_not(data, data + size, is_whitespace) -
+            data);
+
+    if ((count > 1) && (first < size) && ('[' == data[first])) {
+        commas.reserve(count - 1);
+        split(data, size, first, commas, count);
+    }
+
+    if (commas.empty()) {
+        Parser parser{allocator(0)};
+
+        parser.parse(data, size);
+
+        auto status = parser.finish();
+        m_offset = parser.offset();
+        m_value = std::move(parser.value());
+
+        return status;
+    }
+
+    std::vector<Range> ranges(commas.size() + 1);
+    std::vector<std::thread> workers;
+
+    for (Size i = 0; i < ranges.size(); ++i) {
+        auto& range = ranges[i];
+
+        range.begin = i ? (commas[i - 1] + 1) : 0;
+        range.end = (i < commas.size()) ? commas[i] : size;
+        range.content = i ? range.begin : (first + 1);
+    }
+
+    workers.reserve(ranges.size() - 1);
+
+    for (Size i = 1; i < ranges.size(); ++i) {
+        workers.emplace_back(parse_range, std::ref(allocator(i)), data,
+                std::ref(ranges[i]), false, (i + 1) == ranges.size());
+    }
+
+    parse_range(allocator(0), data, ranges.front(), true, false);
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Value array{Value::ARRAY, allocator(0)};
+
+    for (auto& range : ranges) {
+        if (Status::COMPLETE != range.status) {
+            m_offset = range.offset;
+            m_value = Value{Value::NIL, allocator(0)};
+            return Status::ERROR;
+        }
+
+        array.as_array().splice(std::move(range.value.as_array()));
+    }
+
+    m_offset = size;
+    m_value = std::move(array);
+
+    return Status::COMPLETE;
+}
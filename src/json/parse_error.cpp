@@ -0,0 +1,69 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/parse_error.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/parse_error.hpp"
+
+using json::ParseError;
+
+const char* ParseError::message(Code code) noexcept {
+    switch (code) {
+    case NONE:
+        return "no error";
+    case UNEXPECTED_CHARACTER:
+        return "unexpected character";
+    case UNEXPECTED_END:
+        return "unexpected end of input";
+    case TRAILING_CHARACTERS:
+        return "characters after the end of the document";
+    case INVALID_LITERAL:
+        return "invalid literal";
+    case INVALID_NUMBER:
+        return "invalid number";
+    case CONTROL_CHARACTER:
+        return "control character in a string";
+    case INVALID_ESCAPE:
+        return "invalid escape sequence";
+    case INVALID_UNICODE_ESCAPE:
+        return "invalid unicode escape sequence";
+    case INVALID_UTF8:
+        return "invalid UTF-8 sequence";
+    case MISMATCHED_BRACKET:
+        return "mismatched bracket";
+    case HANDLER_REJECTED:
+        return "value rejected by handler";
+    case OUT_OF_MEMORY:
+        return "out of memory";
+    case DEPTH_LIMIT:
+        return "nesting depth limit exceeded";
+    case STRING_LIMIT:
+        return "string length limit exceeded";
+    case MEMBERS_LIMIT:
+        return "object members limit exceeded";
+    case DOCUMENT_LIMIT:
+        return "document size limit exceeded";
+    case FILE_ERROR:
+        return "file can't be read";
+    default:
+        return "unknown error";
+    }
+}
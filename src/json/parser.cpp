@@ -23,295 +23,522 @@
  */
 
 #include "json/parser.hpp"
+#include "json/atoms.hpp"
+#include "json/pair.hpp"
 
-using json::Parser;
-
-Parser::Parser() noexcept { }
-
-Parser::~Parser() noexcept { }
+#include <cstdint>
+#include <utility>
 
-void Parser::unicode_decoded(char32_t ch) noexcept {
-    (this->*m_state)(ch);
+using json::Parser;
+using json::ParserTable;
+using json::Value;
+
+static constexpr json::Size STACK_SIZE{32};
+
+constexpr json::Size json::Limits::NO_LIMIT;
+
+/* Short names keep the tables below readable */
+static constexpr std::uint8_t SP{ParserTable::CLASS_SPACE};
+static constexpr std::uint8_t WS{ParserTable::CLASS_WHITE};
+static constexpr std::uint8_t CC{ParserTable::CLASS_CONTROL};
+static constexpr std::uint8_t BO{ParserTable::CLASS_LCURB};
+static constexpr std::uint8_t BC{ParserTable::CLASS_RCURB};
+static constexpr std::uint8_t KO{ParserTable::CLASS_LSQRB};
+static constexpr std::uint8_t KC{ParserTable::CLASS_RSQRB};
+static constexpr std::uint8_t CN{ParserTable::CLASS_COLON};
+static constexpr std::uint8_t CM{ParserTable::CLASS_COMMA};
+static constexpr std::uint8_t QU{ParserTable::CLASS_QUOTE};
+static constexpr std::uint8_t BS{ParserTable::CLASS_BACKS};
+static constexpr std::uint8_t SL{ParserTable::CLASS_SLASH};
+static constexpr std::uint8_t PS{ParserTable::CLASS_PLUS};
+static constexpr std::uint8_t MS{ParserTable::CLASS_MINUS};
+static constexpr std::uint8_t PO{ParserTable::CLASS_POINT};
+static constexpr std::uint8_t D0{ParserTable::CLASS_ZERO};
+static constexpr std::uint8_t D9{ParserTable::CLASS_DIGIT};
+static constexpr std::uint8_t LA{ParserTable::CLASS_LOW_A};
+static constexpr std::uint8_t LB{ParserTable::CLASS_LOW_B};
+static constexpr std::uint8_t LD{ParserTable::CLASS_LOW_CD};
+static constexpr std::uint8_t LE{ParserTable::CLASS_LOW_E};
+static constexpr std::uint8_t LF{ParserTable::CLASS_LOW_F};
+static constexpr std::uint8_t LL{ParserTable::CLASS_LOW_L};
+static constexpr std::uint8_t LN{ParserTable::CLASS_LOW_N};
+static constexpr std::uint8_t LR{ParserTable::CLASS_LOW_R};
+static constexpr std::uint8_t LS{ParserTable::CLASS_LOW_S};
+static constexpr std::uint8_t LT{ParserTable::CLASS_LOW_T};
+static constexpr std::uint8_t LU{ParserTable::CLASS_LOW_U};
+static constexpr std::uint8_t UE{ParserTable::CLASS_UP_E};
+static constexpr std::uint8_t UH{ParserTable::CLASS_UP_HEX};
+static constexpr std::uint8_t ET{ParserTable::CLASS_ETC};
+static constexpr std::uint8_t U8{ParserTable::CLASS_UTF8};
+
+static constexpr std::uint8_t ID{ParserTable::STATE_IDLE};
+static constexpr std::uint8_t EN{ParserTable::STATE_END};
+static constexpr std::uint8_t VE{ParserTable::STATE_VALUE_END};
+static constexpr std::uint8_t AF{ParserTable::STATE_ARRAY_FIRST};
+static constexpr std::uint8_t OF{ParserTable::STATE_OBJECT_FIRST};
+static constexpr std::uint8_t OK{ParserTable::STATE_OBJECT_KEY};
+static constexpr std::uint8_t OC{ParserTable::STATE_OBJECT_COLON};
+static constexpr std::uint8_t N1{ParserTable::STATE_NULL_1};
+static constexpr std::uint8_t N2{ParserTable::STATE_NULL_2};
+static constexpr std::uint8_t N3{ParserTable::STATE_NULL_3};
+static constexpr std::uint8_t T1{ParserTable::STATE_TRUE_1};
+static constexpr std::uint8_t T2{ParserTable::STATE_TRUE_2};
+static constexpr std::uint8_t T3{ParserTable::STATE_TRUE_3};
+static constexpr std::uint8_t F1{ParserTable::STATE_FALSE_1};
+static constexpr std::uint8_t F2{ParserTable::STATE_FALSE_2};
+static constexpr std::uint8_t F3{ParserTable::STATE_FALSE_3};
+static constexpr std::uint8_t F4{ParserTable::STATE_FALSE_4};
+static constexpr std::uint8_t I1{ParserTable::STATE_INTEGRAL_FIRST};
+static constexpr std::uint8_t I2{ParserTable::STATE_INTEGRAL_SECOND};
+static constexpr std::uint8_t IN{ParserTable::STATE_INTEGRAL_NEXT};
+static constexpr std::uint8_t FD{ParserTable::STATE_FLOATING_DOT};
+static constexpr std::uint8_t R1{ParserTable::STATE_FLOATING_FRACTIONAL_FIRST};
+static constexpr std::uint8_t R2{ParserTable::STATE_FLOATING_FRACTIONAL_DIGIT};
+static constexpr std::uint8_t X1{ParserTable::STATE_FLOATING_EXPONENT_SIGN};
+static constexpr std::uint8_t X2{ParserTable::STATE_FLOATING_EXPONENT_FIRST};
+static constexpr std::uint8_t X3{ParserTable::STATE_FLOATING_EXPONENT_DIGIT};
+static constexpr std::uint8_t S1{ParserTable::STATE_STRING_FIRST};
+static constexpr std::uint8_t SN{ParserTable::STATE_STRING_NEXT};
+static constexpr std::uint8_t SU{ParserTable::STATE_STRING_UTF8};
+static constexpr std::uint8_t SE{ParserTable::STATE_STRING_ESCAPE};
+static constexpr std::uint8_t SX{ParserTable::STATE_STRING_UNICODE};
+static constexpr std::uint8_t Q1{ParserTable::STATE_STRING_SURROGATE_1};
+static constexpr std::uint8_t Q2{ParserTable::STATE_STRING_SURROGATE_2};
+static constexpr std::uint8_t SK{ParserTable::STATE_SKIP};
+
+static constexpr std::uint8_t STR{ParserTable::ACTION_STRING};
+static constexpr std::uint8_t KEY{ParserTable::ACTION_KEY};
+static constexpr std::uint8_t NUM{ParserTable::ACTION_NUMBER};
+static constexpr std::uint8_t NUL{ParserTable::ACTION_NULL};
+static constexpr std::uint8_t TRU{ParserTable::ACTION_TRUE};
+static constexpr std::uint8_t FAL{ParserTable::ACTION_FALSE};
+static constexpr std::uint8_t OAR{ParserTable::ACTION_OPEN_ARRAY};
+static constexpr std::uint8_t OOB{ParserTable::ACTION_OPEN_OBJECT};
+static constexpr std::uint8_t CAR{ParserTable::ACTION_CLOSE_ARRAY};
+static constexpr std::uint8_t COB{ParserTable::ACTION_CLOSE_OBJECT};
+static constexpr std::uint8_t COM{ParserTable::ACTION_COMMA};
+static constexpr std::uint8_t NEN{ParserTable::ACTION_NULL_END};
+static constexpr std::uint8_t TEN{ParserTable::ACTION_TRUE_END};
+static constexpr std::uint8_t FEN{ParserTable::ACTION_FALSE_END};
+static constexpr std::uint8_t ZER{ParserTable::ACTION_ZERO};
+static constexpr std::uint8_t DG1{ParserTable::ACTION_DIGIT_FIRST};
+static constexpr std::uint8_t DGI{ParserTable::ACTION_INTEGRAL_DIGIT};
+static constexpr std::uint8_t PNT{ParserTable::ACTION_POINT};
+static constexpr std::uint8_t DGF{ParserTable::ACTION_FRACTIONAL_DIGIT};
+static constexpr std::uint8_t EXP{ParserTable::ACTION_EXPONENT};
+static constexpr std::uint8_t EXS{ParserTable::ACTION_EXPONENT_SIGN};
+static constexpr std::uint8_t DGE{ParserTable::ACTION_EXPONENT_DIGIT};
+static constexpr std::uint8_t NED{ParserTable::ACTION_NUMBER_END};
+static constexpr std::uint8_t SFI{ParserTable::ACTION_STRING_FIRST};
+static constexpr std::uint8_t SEN{ParserTable::ACTION_STRING_END};
+static constexpr std::uint8_t APP{ParserTable::ACTION_APPEND};
+static constexpr std::uint8_t U8F{ParserTable::ACTION_UTF8_FIRST};
+static constexpr std::uint8_t U8N{ParserTable::ACTION_UTF8_NEXT};
+static constexpr std::uint8_t ESC{ParserTable::ACTION_ESCAPE};
+static constexpr std::uint8_t ESB{ParserTable::ACTION_ESCAPE_CONTROL};
+static constexpr std::uint8_t UNI{ParserTable::ACTION_UNICODE};
+static constexpr std::uint8_t HEX{ParserTable::ACTION_UNICODE_DIGIT};
+static constexpr std::uint8_t SKP{ParserTable::ACTION_SKIP};
+static constexpr std::uint8_t ER{ParserTable::ACTION_ERROR};
+
+const std::uint8_t ParserTable::CLASSES[256]{
+    CC, CC, CC, CC, CC, CC, CC, CC,
+    CC, WS, WS, CC, CC, WS, CC, CC,
+    CC, CC, CC, CC, CC, CC, CC, CC,
+    CC, CC, CC, CC, CC, CC, CC, CC,
+    SP, ET, QU, ET, ET, ET, ET, ET,
+    ET, ET, ET, PS, CM, MS, PO, SL,
+    D0, D9, D9, D9, D9, D9, D9, D9,
+    D9, D9, CN, ET, ET, ET, ET, ET,
+    ET, UH, UH, UH, UH, UE, UH, ET,
+    ET, ET, ET, ET, ET, ET, ET, ET,
+    ET, ET, ET, ET, ET, ET, ET, ET,
+    ET, ET, ET, KO, BS, KC, ET, ET,
+    ET, LA, LB, LD, LD, LE, LF, ET,
+    ET, ET, ET, ET, LL, ET, LN, ET,
+    ET, ET, LR, LS, LT, LU, ET, ET,
+    ET, ET, ET, BO, ET, BC, ET, ET,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8,
+    U8, U8, U8, U8, U8, U8, U8, U8
+};
+
+/* Columns follow the Class order, eight per line:
+ *  SP  WS  CC  BO  BC  KO  KC  CN
+ *  CM  QU  BS  SL  PS  MS  PO  D0
+ *  D9  LA  LB  LD  LE  LF  LL  LN
+ *  LR  LS  LT  LU  UE  UH  ET  U8 */
+const std::uint8_t ParserTable::TRANSITIONS[STATE_COUNT][CLASS_COUNT]{
+    /* error */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* idle */
+    {ID,  ID,  ER,  OOB, ER,  OAR, ER,  ER,
+     ER,  STR, ER,  ER,  ER,  NUM, ER,  NUM,
+     NUM, ER,  ER,  ER,  ER,  FAL, ER,  NUL,
+     ER,  ER,  TRU, ER,  ER,  ER,  ER,  ER},
+    /* end */
+    {EN,  EN,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* value_end */
+    {VE,  VE,  ER,  ER,  COB, ER,  CAR, ER,
+     COM, ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* array_first */
+    {AF,  AF,  ER,  OOB, ER,  OAR, CAR, ER,
+     ER,  STR, ER,  ER,  ER,  NUM, ER,  NUM,
+     NUM, ER,  ER,  ER,  ER,  FAL, ER,  NUL,
+     ER,  ER,  TRU, ER,  ER,  ER,  ER,  ER},
+    /* object_first */
+    {OF,  OF,  ER,  ER,  COB, ER,  ER,  ER,
+     ER,  KEY, ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* object_key */
+    {OK,  OK,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  KEY, ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* object_colon */
+    {OC,  OC,  ER,  ER,  ER,  ER,  ER,  ID,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* null_1 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  N2,  ER,  ER,  ER,  ER},
+    /* null_2 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  N3,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* null_3 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  NEN, ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* true_1 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     T2,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* true_2 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  T3,  ER,  ER,  ER,  ER},
+    /* true_3 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  TEN, ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* false_1 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  F2,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* false_2 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  F3,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* false_3 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  F4,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* false_4 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  FEN, ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* integral_first */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  NUM, ER,  NUM,
+     NUM, ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* integral_second */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ZER,
+     DG1, ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* integral_next */
+    {NED, NED, NED, NED, NED, NED, NED, NED,
+     NED, NED, NED, NED, NED, NED, PNT, DGI,
+     DGI, NED, NED, NED, EXP, NED, NED, NED,
+     NED, NED, NED, NED, EXP, NED, NED, NED},
+    /* floating_dot */
+    {NED, NED, NED, NED, NED, NED, NED, NED,
+     NED, NED, NED, NED, NED, NED, PNT, NED,
+     NED, NED, NED, NED, EXP, NED, NED, NED,
+     NED, NED, NED, NED, EXP, NED, NED, NED},
+    /* floating_fractional_first */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  DGF,
+     DGF, ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* floating_fractional_digit */
+    {NED, NED, NED, NED, NED, NED, NED, NED,
+     NED, NED, NED, NED, NED, NED, NED, DGF,
+     DGF, NED, NED, NED, EXP, NED, NED, NED,
+     NED, NED, NED, NED, EXP, NED, NED, NED},
+    /* floating_exponent_sign */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  EXS, EXS, ER,  DGE,
+     DGE, ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* floating_exponent_first */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  DGE,
+     DGE, ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* floating_exponent_digit */
+    {NED, NED, NED, NED, NED, NED, NED, NED,
+     NED, NED, NED, NED, NED, NED, NED, DGE,
+     DGE, NED, NED, NED, NED, NED, NED, NED,
+     NED, NED, NED, NED, NED, NED, NED, NED},
+    /* string_first */
+    {SFI, SFI, SFI, SFI, SFI, SFI, SFI, SFI,
+     SFI, SFI, SFI, SFI, SFI, SFI, SFI, SFI,
+     SFI, SFI, SFI, SFI, SFI, SFI, SFI, SFI,
+     SFI, SFI, SFI, SFI, SFI, SFI, SFI, SFI},
+    /* string_next */
+    {APP, ER,  ER,  APP, APP, APP, APP, APP,
+     APP, SEN, SE,  APP, APP, APP, APP, APP,
+     APP, APP, APP, APP, APP, APP, APP, APP,
+     APP, APP, APP, APP, APP, APP, APP, U8F},
+    /* string_utf8 */
+    {U8N, U8N, U8N, U8N, U8N, U8N, U8N, U8N,
+     U8N, U8N, U8N, U8N, U8N, U8N, U8N, U8N,
+     U8N, U8N, U8N, U8N, U8N, U8N, U8N, U8N,
+     U8N, U8N, U8N, U8N, U8N, U8N, U8N, U8N},
+    /* string_escape */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ESC, ESC, ESC, ER,  ER,  ER,  ER,
+     ER,  ER,  ESB, ER,  ER,  ESB, ER,  ESB,
+     ESB, ER,  ESB, UNI, ER,  ER,  ER,  ER},
+    /* string_unicode */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  HEX,
+     HEX, HEX, HEX, HEX, HEX, HEX, ER,  ER,
+     ER,  ER,  ER,  ER,  HEX, HEX, ER,  ER},
+    /* string_surrogate_1 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  Q2,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER},
+    /* string_surrogate_2 */
+    {ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  ER,  ER,  ER,  ER,  ER,
+     ER,  ER,  ER,  UNI, ER,  ER,  ER,  ER},
+    /* skip */
+    {SKP, SKP, SKP, SKP, SKP, SKP, SKP, SKP,
+     SKP, SKP, SKP, SKP, SKP, SKP, SKP, SKP,
+     SKP, SKP, SKP, SKP, SKP, SKP, SKP, SKP,
+     SKP, SKP, SKP, SKP, SKP, SKP, SKP, SKP}
+};
+
+Parser::Parser() noexcept :
+    Parser{Allocator::get_instance()}
+{ }
+
+Parser::Parser(Allocator& alloc) noexcept :
+    m_allocator{&alloc},
+    m_value{Value::NIL, alloc},
+    m_key{alloc},
+    m_parser{*this, alloc}
+{
+    /* Container stack is reserved upfront, deep documents grow it */
+    m_stack = m_allocator->allocate<Value*>(STACK_SIZE);
+    if (m_stack) {
+        m_stack_size = STACK_SIZE;
+    }
 }
 
-void Parser::unicode_decoded(char32_t ch,
-        unicode::Error /* error */) noexcept {
-    m_state = &Parser::state_error;
-    (this->*m_state)(ch);
+Parser::Parser(Allocator& alloc, Atoms& atoms) noexcept :
+    Parser{alloc}
+{
+    m_atoms = &atoms;
 }
 
-void Parser::unicode_encoded(char32_t) noexcept { }
-
-void Parser::unicode_encoded(char32_t, unicode::Error) noexcept { }
-
-void Parser::state_error(char32_t /* ch */) noexcept { }
-
-void Parser::state_idle(char32_t ch) noexcept {
-    switch (ch) {
-    case ' ':
-    case '\t':
-    case '\r':
-    case '\n':
-        break;
-    case '"':
-        m_state = &Parser::state_string_first;
-        break;
-    case 'n':
-        m_state = &Parser::state_null_1;
-        break;
-    case 't':
-        m_state = &Parser::state_true_1;
-        break;
-    case 'f':
-        m_state = &Parser::state_false_1;
-        break;
-    case '-':
-    case '0':
-    case '1':
-    case '2':
-    case '3':
-    case '4':
-    case '5':
-    case '6':
-    case '7':
-    case '8':
-    case '9':
-        state_integral_first(ch);
-        break;
-    case '[':
-        break;
-    case '{':
-        break;
-    default:
-        m_state = &Parser::state_error;
-        break;
-    }
+Parser::~Parser() noexcept {
+    m_allocator->deallocate(m_stack);
 }
 
-void Parser::state_null_1(char32_t ch) noexcept {
-    if ('u' == ch) {
-        m_state = &Parser::state_null_2;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+json::Status Parser::put(Char ch) noexcept {
+    return m_parser.put(ch);
 }
 
-void Parser::state_null_2(char32_t ch) noexcept {
-    if ('l' == ch) {
-        m_state = &Parser::state_null_3;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+json::Status Parser::parse(const Char* data, Size size) noexcept {
+    return m_parser.parse(data, size);
 }
 
-void Parser::state_null_3(char32_t ch) noexcept {
-    if ('l' == ch) {
-        m_state = &Parser::state_idle;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+json::Status Parser::finish() noexcept {
+    return m_parser.finish();
 }
 
-void Parser::state_true_1(char32_t ch) noexcept {
-    if ('r' == ch) {
-        m_state = &Parser::state_true_2;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+void Parser::reset() noexcept {
+    m_parser.reset();
+    m_depth = 0;
+    m_value = Value{Value::NIL, *m_allocator};
 }
 
-void Parser::state_true_2(char32_t ch) noexcept {
-    if ('u' == ch) {
-        m_state = &Parser::state_true_3;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+bool Parser::null() noexcept {
+    return value_end(nullptr != insert(Value{Value::NIL, *m_allocator}));
 }
 
-void Parser::state_true_3(char32_t ch) noexcept {
-    if ('e' == ch) {
-        m_state = &Parser::state_idle;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+bool Parser::boolean(Bool value) noexcept {
+    return value_end(nullptr != insert(Value{value}));
 }
 
-void Parser::state_false_1(char32_t ch) noexcept {
-    if ('a' == ch) {
-        m_state = &Parser::state_false_2;
-    }
-    else {
-        m_state = &Parser::state_error;
+bool Parser::number(const Number& value) noexcept {
+    /* Raw text outlives the call only inside of the in situ buffer */
+    if (value.is_raw() && !m_is_in_situ) {
+        return value_end(nullptr != insert(
+                    Value{value.converted(*m_allocator)}));
     }
-}
 
-void Parser::state_false_2(char32_t ch) noexcept {
-    if ('l' == ch) {
-        m_state = &Parser::state_false_3;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+    return value_end(nullptr != insert(Value{value}));
 }
 
-void Parser::state_false_3(char32_t ch) noexcept {
-    if ('s' == ch) {
-        m_state = &Parser::state_false_4;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
-}
+bool Parser::string(const StringView& value) noexcept {
+    String string{*m_allocator};
 
-void Parser::state_false_4(char32_t ch) noexcept {
-    if ('e' == ch) {
-        m_state = &Parser::state_idle;
+    if (m_is_in_situ) {
+        /* In situ views point into the caller's mutable buffer */
+        string.borrow(const_cast<Char*>(value.data()), value.size());
     }
     else {
-        m_state = &Parser::state_error;
+        string.assign(value.data(), value.size());
     }
-}
 
-void Parser::state_string_first(char32_t ch) noexcept {
-    if ('\"' == ch) {
-        m_state = &Parser::state_idle;
-    }
-    else {
-        m_state = &Parser::state_string_next;
-    }
+    return value_end(nullptr != insert(std::move(string)));
 }
 
-void Parser::state_string_next(char32_t ch) noexcept {
-    if ('\"' == ch) {
-        m_state = &Parser::state_idle;
-    }
-    else {
+bool Parser::key(const StringView& value) noexcept {
+    if (m_atoms) {
+        auto atom = m_atoms->intern(value);
 
-    }
-}
+        if (!atom.data()) {
+            return false;
+        }
 
-void Parser::state_integral_first(char32_t ch) noexcept {
-    if ('-' == ch) {
-        m_is_negative = true;
-        m_state = &Parser::state_integral_second;
+        m_key.borrow(const_cast<Char*>(atom.data()), atom.size());
     }
-    else if ('0' == ch) {
-        m_is_negative = false;
-        m_uint = 0;
-        m_state = &Parser::state_floating_dot;
+    else if (m_is_in_situ) {
+        m_key.borrow(const_cast<Char*>(value.data()), value.size());
     }
     else {
-        m_is_negative = false;
-        m_uint = Uint(ch - '0');
-        m_state = &Parser::state_integral_next;
+        m_key.assign(value.data(), value.size());
     }
-}
 
-void Parser::state_integral_second(char32_t ch) noexcept {
-    if ('0' == ch) {
-        m_uint = 0;
-        m_state = &Parser::state_floating_dot;
-    }
-    else if ((ch >= '1') && (ch <= '9')) {
-        m_uint = Uint(ch - '0');
-        m_state = &Parser::state_integral_next;
-    }
-    else {
-        m_state = &Parser::state_error;
-    }
+    return true;
 }
 
-void Parser::state_integral_next(char32_t ch) noexcept {
-    if ((ch >= '0') && (ch <= '9')) {
-        m_uint = (10 * m_uint) + Uint(ch - '0');
-    }
-    else if ('.' == ch) {
-        m_double = Double(m_uint);
-        m_state = &Parser::state_floating_fractional_digit;
-    }
-    else if (('e' == ch) || ('E' == ch)) {
-        m_double = Double(m_uint);
-    }
-    else {
+bool Parser::start_object() noexcept {
+    return open(Value::OBJECT);
+}
 
-    }
+bool Parser::end_object() noexcept {
+    --m_depth;
+    return value_end(true);
 }
 
-void Parser::state_floating_integral_digit(char32_t ch) noexcept {
-    if ((ch >= '0') && (ch <= '9')) {
-        m_double = (10 * m_double) + Uint(ch - '0');
-    }
-    else if ('.' == ch) {
-        m_state = &Parser::state_floating_fractional_digit;
-    }
-    else if (('e' == ch) || ('E' == ch)) {
-        m_state = &Parser::state_floating_exponent_sign;
-    }
-    else {
+bool Parser::start_array() noexcept {
+    return open(Value::ARRAY);
+}
 
-    }
+bool Parser::end_array() noexcept {
+    --m_depth;
+    return value_end(true);
 }
 
-void Parser::state_floating_dot(char32_t ch) noexcept {
-    if ('.' == ch) {
-        m_double = Double(m_uint);
-        m_state = &Parser::state_floating_fractional_digit;
-    }
-    else if (('e' == ch) || ('E' == ch)) {
-        m_state = &Parser::state_floating_exponent_sign;
+Value* Parser::insert(Value&& value) noexcept {
+    Value* inserted = nullptr;
+
+    if (0 == m_depth) {
+        m_value = std::move(value);
+        inserted = &m_value;
     }
     else {
+        auto parent = m_stack[m_depth - 1];
 
-    }
-}
+        /* Items are appended in place, a failed allocation leaves
+         * the last item unchanged */
+        if (parent->is_array()) {
+            auto& array = parent->as_array();
+            auto last = array.empty() ? nullptr : &array.back();
 
-void Parser::state_floating_fractional_digit(char32_t ch) noexcept {
-    if ((ch >= '0') && (ch <= '9')) {
+            array.emplace_back(std::move(value), parent);
 
-    }
-    else if (('e' == ch) || ('E' == ch)) {
-        m_state = &Parser::state_floating_exponent_sign;
-    }
-    else {
+            if (!array.empty() && (&array.back() != last)) {
+                inserted = &array.back();
+            }
+        }
+        else {
+            auto& object = parent->as_object();
+            auto last = object.empty() ? nullptr : &object.back();
 
-    }
-}
+            object.emplace_back(Pair{std::move(m_key), std::move(value)},
+                    parent);
 
-void Parser::state_floating_exponent(char32_t ch) noexcept {
-    if (('e' == ch) || ('E' == ch)) {
-        m_state = &Parser::state_floating_exponent_sign;
+            if (!object.empty() && (&object.back() != last)) {
+                inserted = &object.back().value();
+            }
+        }
     }
-    else {
 
-    }
+    return inserted;
 }
 
-void Parser::state_floating_exponent_sign(char32_t ch) noexcept {
-    if ('-' == ch) {
-        m_state = &Parser::state_floating_exponent_digit;
-    }
-    else if ('+' == ch) {
-        m_state = &Parser::state_floating_exponent_digit;
-    }
-    else if ((ch >= '0') && (ch <= '9')) {
-        m_state = &Parser::state_floating_exponent_digit;
+bool Parser::value_end(bool accepted) noexcept {
+    /* Stops parse_one() behind a complete document */
+    if (m_is_one && !m_depth) {
+        m_parser.suspend();
     }
-    else {
 
-    }
+    return accepted;
 }
 
-void Parser::state_floating_exponent_digit(char32_t ch) noexcept {
-    if ((ch >= '0') && (ch <= '9')) {
+bool Parser::open(Value::Type type) noexcept {
+    if (m_depth >= m_stack_size) {
+        auto size = m_stack_size ? (2 * m_stack_size) : STACK_SIZE;
+        auto stack = m_allocator->reallocate(m_stack, size);
 
+        if (!stack) {
+            return false;
+        }
+
+        m_stack = stack;
+        m_stack_size = size;
     }
-    else {
 
+    auto container = insert(Value{type, *m_allocator});
+
+    if (container) {
+        m_stack[m_depth++] = container;
     }
+
+    return nullptr != container;
 }
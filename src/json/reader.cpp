@@ -0,0 +1,135 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/reader.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/reader.hpp"
+
+using json::Reader;
+
+constexpr json::Size Reader::TOKENS_SIZE;
+
+Reader::Reader(const Char* data, Size size, Allocator& alloc) noexcept :
+    m_data{data},
+    m_size{size},
+    m_parser{*this, alloc}
+{ }
+
+bool Reader::next() noexcept {
+    if (m_tokens_length) {
+        m_tokens_first = (m_tokens_first + 1) % TOKENS_SIZE;
+        --m_tokens_length;
+    }
+
+    while (!m_tokens_length && (Status::ERROR != m_parser.status())) {
+        auto offset = m_parser.offset();
+
+        if (offset < m_size) {
+            m_parser.parse(m_data + offset, m_size - offset);
+        }
+        else if (!m_is_finished) {
+            m_is_finished = true;
+            m_parser.finish();
+        }
+        else {
+            break;
+        }
+    }
+
+    return 0 != m_tokens_length;
+}
+
+void Reader::skip_value() noexcept {
+    switch (token_type()) {
+    case START_OBJECT:
+    case START_ARRAY:
+        --m_depth;
+        m_parser.skip_value();
+        break;
+    case KEY:
+        m_parser.skip_value();
+        break;
+    case NONE:
+    case NIL:
+    case BOOLEAN:
+    case NUMBER:
+    case STRING:
+    case END_OBJECT:
+    case END_ARRAY:
+    default:
+        break;
+    }
+}
+
+bool Reader::push(TokenType type) noexcept {
+    m_tokens[(m_tokens_first + m_tokens_length) % TOKENS_SIZE] = {type,
+        m_depth};
+    ++m_tokens_length;
+
+    m_parser.suspend();
+
+    return true;
+}
+
+bool Reader::null() noexcept {
+    return push(NIL);
+}
+
+bool Reader::boolean(Bool value) noexcept {
+    m_bool = value;
+    return push(BOOLEAN);
+}
+
+bool Reader::number(const Number& value) noexcept {
+    m_number = value;
+    return push(NUMBER);
+}
+
+bool Reader::string(const StringView& value) noexcept {
+    m_string = value;
+    return push(STRING);
+}
+
+bool Reader::key(const StringView& value) noexcept {
+    m_string = value;
+    return push(KEY);
+}
+
+bool Reader::start_object() noexcept {
+    ++m_depth;
+    return push(START_OBJECT);
+}
+
+bool Reader::end_object() noexcept {
+    --m_depth;
+    return push(END_OBJECT);
+}
+
+bool Reader::start_array() noexcept {
+    ++m_depth;
+    return push(START_ARRAY);
+}
+
+bool Reader::end_array() noexcept {
+    --m_depth;
+    return push(END_ARRAY);
+}
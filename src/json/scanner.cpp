@@ -0,0 +1,272 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/scanner.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/scanner.hpp"
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+using json::Scanner;
+
+using Mask = Scanner::Mask;
+
+static constexpr Mask EVEN_BITS{0x5555555555555555};
+
+static constexpr json::Char PADDING{' '};
+
+#if defined(__AVX2__)
+
+static inline __m256i equal(__m256i chunk, char ch) noexcept {
+    return _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(ch));
+}
+
+static inline Mask movemask(__m256i chunk, unsigned shift) noexcept {
+    return Mask(std::uint32_t(_mm256_movemask_epi8(chunk))) << shift;
+}
+
+static void classify(const json::Char* data, Scanner::Block& block) noexcept {
+    auto case_bit = _mm256_set1_epi8(0x20);
+
+    block = {};
+
+    for (unsigned i = 0; i < Scanner::BLOCK_SIZE; i += 32) {
+        auto chunk = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data + i));
+        auto lower = _mm256_or_si256(chunk, case_bit);
+
+        auto open = equal(lower, '{');
+        auto close = equal(lower, '}');
+        auto structural = _mm256_or_si256(_mm256_or_si256(open, close),
+                _mm256_or_si256(equal(chunk, ':'), equal(chunk, ',')));
+
+        auto whitespace = _mm256_or_si256(
+                _mm256_or_si256(equal(chunk, ' '), equal(chunk, '\t')),
+                _mm256_or_si256(equal(chunk, '\n'), equal(chunk, '\r')));
+
+        block.quote |= movemask(equal(chunk, '"'), i);
+        block.backslash |= movemask(equal(chunk, '\\'), i);
+        block.open |= movemask(open, i);
+        block.close |= movemask(close, i);
+        block.structural |= movemask(structural, i);
+        block.whitespace |= movemask(whitespace, i);
+    }
+}
+
+Mask Scanner::string_stops(const Char* data) noexcept {
+    auto control_max = _mm256_set1_epi8(0x1F);
+    Mask stops = 0;
+
+    for (unsigned i = 0; i < BLOCK_SIZE; i += 32) {
+        auto chunk = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(data + i));
+        auto control = _mm256_cmpeq_epi8(
+                _mm256_min_epu8(chunk, control_max), chunk);
+
+        stops |= movemask(_mm256_or_si256(
+                    _mm256_or_si256(equal(chunk, '"'), equal(chunk, '\\')),
+                    _mm256_or_si256(control, chunk)), i);
+    }
+
+    return stops;
+}
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+static inline __m128i equal(__m128i chunk, char ch) noexcept {
+    return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(ch));
+}
+
+static inline Mask movemask(__m128i chunk, unsigned shift) noexcept {
+    return Mask(std::uint16_t(_mm_movemask_epi8(chunk))) << shift;
+}
+
+static void classify(const json::Char* data, Scanner::Block& block) noexcept {
+    auto case_bit = _mm_set1_epi8(0x20);
+
+    block = {};
+
+    for (unsigned i = 0; i < Scanner::BLOCK_SIZE; i += 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        auto lower = _mm_or_si128(chunk, case_bit);
+
+        auto open = equal(lower, '{');
+        auto close = equal(lower, '}');
+        auto structural = _mm_or_si128(_mm_or_si128(open, close),
+                _mm_or_si128(equal(chunk, ':'), equal(chunk, ',')));
+
+        auto whitespace = _mm_or_si128(
+                _mm_or_si128(equal(chunk, ' '), equal(chunk, '\t')),
+                _mm_or_si128(equal(chunk, '\n'), equal(chunk, '\r')));
+
+        block.quote |= movemask(equal(chunk, '"'), i);
+        block.backslash |= movemask(equal(chunk, '\\'), i);
+        block.open |= movemask(open, i);
+        block.close |= movemask(close, i);
+        block.structural |= movemask(structural, i);
+        block.whitespace |= movemask(whitespace, i);
+    }
+}
+
+Mask Scanner::string_stops(const Char* data) noexcept {
+    auto control_max = _mm_set1_epi8(0x1F);
+    Mask stops = 0;
+
+    for (unsigned i = 0; i < BLOCK_SIZE; i += 16) {
+        auto chunk = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(data + i));
+        auto control = _mm_cmpeq_epi8(
+                _mm_min_epu8(chunk, control_max), chunk);
+
+        stops |= movemask(_mm_or_si128(
+                    _mm_or_si128(equal(chunk, '"'), equal(chunk, '\\')),
+                    _mm_or_si128(control, chunk)), i);
+    }
+
+    return stops;
+}
+
+#else
+
+static void classify(const json::Char* data, Scanner::Block& block) noexcept {
+    block = {};
+
+    for (std::size_t i = 0; i < Scanner::BLOCK_SIZE; ++i) {
+        auto ch = std::uint8_t(data[i]);
+        Mask bit = Mask(1) << i;
+
+        switch (ch) {
+        case '"':
+            block.quote |= bit;
+            break;
+        case '\\':
+            block.backslash |= bit;
+            break;
+        case '{':
+        case '[':
+            block.open |= bit;
+            block.structural |= bit;
+            break;
+        case '}':
+        case ']':
+            block.close |= bit;
+            block.structural |= bit;
+            break;
+        case ':':
+        case ',':
+            block.structural |= bit;
+            break;
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+            block.whitespace |= bit;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+Mask Scanner::string_stops(const Char* data) noexcept {
+    Mask stops = 0;
+
+    for (unsigned i = 0; i < BLOCK_SIZE; ++i) {
+        auto ch = std::uint8_t(data[i]);
+
+        if (('"' == ch) || ('\\' == ch) || (ch < 0x20) || (ch >= 0x80)) {
+            stops |= Mask(1) << i;
+        }
+    }
+
+    return stops;
+}
+
+#endif
+
+static inline Mask prefix_xor(Mask mask) noexcept {
+    mask ^= (mask << 1);
+    mask ^= (mask << 2);
+    mask ^= (mask << 4);
+    mask ^= (mask << 8);
+    mask ^= (mask << 16);
+    mask ^= (mask << 32);
+    return mask;
+}
+
+void Scanner::scan(const Char* data, Block& block) noexcept {
+    classify(data, block);
+
+    /* Characters preceded by an odd number of backslashes are escaped */
+    auto backslash = block.backslash & ~m_escaped;
+    auto follows_escape = (backslash << 1) | m_escaped;
+    auto odd_starts = backslash & ~EVEN_BITS & ~follows_escape;
+    auto even_starts = odd_starts + backslash;
+
+    m_escaped = (even_starts < backslash) ? 1 : 0;
+    block.escaped = (EVEN_BITS ^ (even_starts << 1)) & follows_escape;
+
+    /* Unescaped quotes toggle between inside and outside of a string */
+    block.string = prefix_xor(block.quote & ~block.escaped) ^ m_in_string;
+    block.open &= ~block.string;
+    block.close &= ~block.string;
+    block.structural &= ~block.string;
+
+    m_in_string = (block.string >> (BLOCK_SIZE - 1)) ? ~Mask(0) : Mask(0);
+}
+
+void Scanner::scan(const Char* data, Size size, Block& block) noexcept {
+    if (size >= BLOCK_SIZE) {
+        scan(data, block);
+    }
+    else if (0 == size) {
+        block = {};
+    }
+    else {
+        Char buffer[BLOCK_SIZE];
+        Mask valid = (Mask(1) << size) - 1;
+
+        std::fill(std::copy_n(data, size, buffer), buffer + BLOCK_SIZE,
+                PADDING);
+
+        scan(buffer, block);
+
+        /* Carry state must describe the last valid byte, not the padding */
+        m_escaped = (block.escaped >> size) & 1;
+        m_in_string = ((block.string >> (size - 1)) & 1) ? ~Mask(0) : Mask(0);
+
+        block.quote &= valid;
+        block.backslash &= valid;
+        block.escaped &= valid;
+        block.string &= valid;
+        block.open &= valid;
+        block.close &= valid;
+        block.structural &= valid;
+        block.whitespace &= valid;
+    }
+}
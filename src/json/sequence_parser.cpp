@@ -0,0 +1,76 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * * @file json/sequence_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/sequence_parser.hpp"
+
+#include <algorithm>
+
+using json::SequenceParser;
+
+static inline bool is_whitespace(json::Char ch) noexcept {
+    return (' ' == ch) || ('\t' == ch) || ('\n' == ch) || ('\r' == ch);
+}
+
+SequenceParser::SequenceParser(const Char* data, Size size,
+        Allocator& alloc) noexcept :
+    m_data{data},
+    m_size{size},
+    m_parser{alloc}
+{ }
+
+bool SequenceParser::next() noexcept {
+    if (m_is_finished) {
+        return false;
+    }
+
+    m_parser.restart();
+
+    auto offset = m_parser.offset();
+
+    if (offset < m_size) {
+        auto status = m_parser.parse_one(m_data + offset, m_size - offset);
+
+        if (Status::NEED_MORE != status) {
+            m_is_finished = (Status::ERROR == status);
+            return !m_is_finished;
+        }
+    }
+
+    m_is_finished = true;
+
+    /* Only whitespace after the last document, or a top level number
+     * that ends with the input */
+    if (std::all_of(m_data + offset, m_data + m_size, is_whitespace)) {
+        return false;
+    }
+
+    return Status::COMPLETE == m_parser.finish();
+}
+
+json::Status SequenceParser::status() const noexcept {
+    if (Status::ERROR == m_parser.status()) {
+        return Status::ERROR;
+    }
+
+    return m_is_finished ? Status::COMPLETE : Status::NEED_MORE;
+}
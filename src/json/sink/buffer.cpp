@@ -0,0 +1,68 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/buffer.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/sink/buffer.hpp"
+
+using json::sink::Buffer;
+
+constexpr json::Size Buffer::INITIAL_SIZE;
+
+Buffer::~Buffer() noexcept {
+    m_allocator->deallocate(m_data);
+}
+
+auto Buffer::acquire(Size size) noexcept -> Span<Char> {
+    if (!size) {
+        size = 1;
+    }
+
+    if ((m_capacity - m_size) < size) {
+        auto capacity = m_capacity ? m_capacity : INITIAL_SIZE;
+
+        while ((capacity - m_size) < size) {
+            capacity *= 2;
+        }
+
+        auto data = m_allocator->reallocate(m_data, capacity);
+
+        if (!data) {
+            return {};
+        }
+
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    return {m_data + m_size, m_capacity - m_size};
+}
+
+bool Buffer::commit(Size size) noexcept {
+    m_size += size;
+    return true;
+}
+
+bool Buffer::flush() noexcept {
+    return true;
+}
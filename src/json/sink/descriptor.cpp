@@ -0,0 +1,66 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/descriptor.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/sink/descriptor.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#define JSON_POSIX_WRITE
+#endif
+
+using json::sink::Descriptor;
+
+Descriptor::~Descriptor() noexcept {
+    flush();
+}
+
+#if defined(JSON_POSIX_WRITE)
+
+bool Descriptor::write(const Char* data, Size size) noexcept {
+    while (size) {
+        auto written = ::write(m_fd, data, size);
+
+        if (written < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            return false;
+        }
+
+        data += written;
+        size -= Size(written);
+    }
+
+    return true;
+}
+
+#else
+
+bool Descriptor::write(const Char*, Size) noexcept {
+    return false;
+}
+
+#endif
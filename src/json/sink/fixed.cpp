@@ -0,0 +1,49 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/fixed.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/sink/fixed.hpp"
+
+using json::sink::Fixed;
+
+Fixed::~Fixed() noexcept { }
+
+auto Fixed::acquire(Size size) noexcept -> Span<Char> {
+    auto available = m_capacity - m_size;
+
+    if (!available || (available < size)) {
+        return {};
+    }
+
+    return {m_data + m_size, available};
+}
+
+bool Fixed::commit(Size size) noexcept {
+    m_size += size;
+    return true;
+}
+
+bool Fixed::flush() noexcept {
+    return true;
+}
@@ -0,0 +1,63 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/sink/stream.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/sink/stream.hpp"
+
+using json::sink::Stream;
+
+constexpr json::Size Stream::CHUNK_SIZE;
+
+Stream::~Stream() noexcept { }
+
+auto Stream::acquire(Size size) noexcept -> Span<Char> {
+    if (size > CHUNK_SIZE) {
+        return {};
+    }
+
+    if (((CHUNK_SIZE - m_size) < size) || (CHUNK_SIZE == m_size)) {
+        if (!write_chunk()) {
+            return {};
+        }
+    }
+
+    return {m_chunk + m_size, CHUNK_SIZE - m_size};
+}
+
+bool Stream::commit(Size size) noexcept {
+    m_size += size;
+    return true;
+}
+
+bool Stream::flush() noexcept {
+    return write_chunk();
+}
+
+bool Stream::write_chunk() noexcept {
+    auto size = m_size;
+
+    m_size = 0;
+
+    return !size || write(m_chunk, size);
+}
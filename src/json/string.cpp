@@ -67,7 +67,9 @@ String& String::insert(size_type index, const_pointer s) noexcept {
     return *this;
 }
 
-String::String(String&& other) noexcept {
+String::String(String&& other) noexcept :
+    m_allocator{&other.allocator()}
+{
     assign(std::move(other));
 }
 
@@ -79,7 +81,36 @@ String::String(std::initializer_list<value_type> ilist,
 }
 
 String::~String() noexcept {
-    allocator().deallocate(data());
+    if (!m_is_borrowed) {
+        allocator().deallocate(data());
+    }
+}
+
+String& String::borrow(pointer s, size_type count) noexcept {
+    if (!m_is_borrowed) {
+        allocator().deallocate(m_data);
+    }
+
+    m_data = s;
+    m_size = count;
+    m_is_borrowed = true;
+
+    return *this;
+}
+
+String::pointer String::reallocate(size_type count) noexcept {
+    if (!m_is_borrowed) {
+        return allocator().reallocate(data(), count);
+    }
+
+    auto ptr = allocator().allocate<value_type>(count);
+
+    if (ptr) {
+        copy_n(data(), std::min(size(), count), ptr);
+        m_is_borrowed = false;
+    }
+
+    return ptr;
 }
 
 String::pointer String::insert(size_type index, const StringView& str,
@@ -102,12 +133,16 @@ String::pointer String::insert(size_type index, const StringView& str,
 String& String::assign(String&& other) noexcept {
     if (&other != this) {
         if (&other.allocator() == &allocator()) {
-            allocator().deallocate(m_data);
+            if (!m_is_borrowed) {
+                allocator().deallocate(m_data);
+            }
 
             m_data = other.data();
             m_size = other.size();
+            m_is_borrowed = other.m_is_borrowed;
             other.m_data = nullptr;
             other.m_size = 0;
+            other.m_is_borrowed = false;
         }
         else {
             assign(std::cref(other));
@@ -118,12 +153,12 @@ String& String::assign(String&& other) noexcept {
 }
 
 String::size_type String::capacity() const noexcept {
-    return allocator().size(data());
+    return m_is_borrowed ? 0 : allocator().size(data());
 }
 
 void String::shrink_to_fit() noexcept {
     if (capacity() > size()) {
-        auto ptr = allocator().reallocate(data(), size());
+        auto ptr = reallocate(size());
         if (ptr) {
             m_data = ptr;
         }
@@ -132,7 +167,7 @@ void String::shrink_to_fit() noexcept {
 
 void String::reserve(size_type new_capacity) noexcept {
     if (capacity() < new_capacity) {
-        auto ptr = allocator().reallocate(data(), new_capacity);
+        auto ptr = reallocate(new_capacity);
         if (ptr) {
             m_data = ptr;
         }
@@ -141,7 +176,7 @@ void String::reserve(size_type new_capacity) noexcept {
 
 void String::resize(size_type count) noexcept {
     if (capacity() < count) {
-        auto ptr = allocator().reallocate(data(), count);
+        auto ptr = reallocate(count);
         if (ptr) {
             m_data = ptr;
             m_size = count;
@@ -179,7 +214,7 @@ void String::push_back(value_type ch) noexcept {
         m_data[m_size++] = ch;
     }
     else {
-        auto ptr = allocator().allocate<value_type>(size() + 1);
+        auto ptr = reallocate(size() + 1);
         if (ptr) {
             m_data = ptr;
             m_data[m_size++] = ch;
@@ -190,12 +225,12 @@ void String::push_back(value_type ch) noexcept {
 String::const_pointer String::c_str() noexcept {
     String::const_pointer str = data();
 
-    if (m_data[size()] != '\0') {
+    if (m_is_borrowed || (m_data[size()] != '\0')) {
         if (size() < capacity()) {
             m_data[size()] = '\0';
         }
         else {
-            str = allocator().reallocate<value_type>(data(), size() + 1);
+            str = reallocate(size() + 1);
             if (str) {
                 m_data = const_cast<String::pointer>(str);
                 m_data[size()] = '\0';
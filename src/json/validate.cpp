@@ -0,0 +1,61 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file json/validate.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/validate.hpp"
+#include "json/parser.hpp"
+#include "json/allocator/pool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+using json::Validation;
+
+/* Nesting stack takes a bit per level and grows by doubling, old and new
+ * stacks must fit */
+static constexpr json::Size STACK_MEMORY{json::VALIDATE_DEPTH_MAX / 4};
+
+namespace {
+
+class Validator final : public json::Handler<Validator> {
+public:
+    static constexpr bool NEEDS_VALUES{false};
+};
+
+}
+
+Validation json::validate(const Char* data, Size size) noexcept {
+    alignas(std::max_align_t) std::uint8_t memory[STACK_MEMORY];
+    allocator::Pool pool{memory, sizeof(memory)};
+    Validator validator;
+    BasicParser<Validator> parser{validator, pool};
+    Limits limits;
+
+    limits.depth = VALIDATE_DEPTH_MAX;
+    parser.set_limits(limits);
+
+    parser.parse(data, size);
+    parser.finish();
+
+    return parser.error();
+}
@@ -119,12 +119,10 @@ void Value::assign(const Value& other) noexcept {
 
 void Value::assign(Value&& other) noexcept {
     if (this != &other) {
-        m_parent = other.parent();
+        destroy();
 
-        if (type() != other.type()) {
-            destroy();
-            m_type = other.type();
-        }
+        m_type = other.type();
+        m_parent = other.parent();
 
         switch (type()) {
         case BOOLEAN:
@@ -138,9 +136,16 @@ void Value::assign(Value&& other) noexcept {
             break;
         case ARRAY:
             new (&m_array) Array(std::move(other.m_array));
+            /* Moved children still point to the old parent */
+            for (auto& value : m_array) {
+                value.m_parent = this;
+            }
             break;
         case OBJECT:
             new (&m_object) Object(std::move(other.m_object));
+            for (auto& pair : m_object) {
+                pair.value().m_parent = this;
+            }
             break;
         case NIL:
         default:
@@ -0,0 +1,338 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file json/writer.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/writer.hpp"
+#include "json/pair.hpp"
+#include "json/floating.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+using json::Writer;
+
+constexpr json::Size Writer::NUMBER_SIZE;
+
+static constexpr json::Size ESCAPE_SIZE{6};
+
+/* Escape letter of every byte in strings, 'u' is written as \u00XX */
+static const json::Char ESCAPES[256]{
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+      0,   0, '"',   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0, '\\',  0,   0,   0
+};
+
+static const json::Char HEX[]{"0123456789abcdef"};
+
+Writer::Writer(Sink& sink) noexcept :
+    m_sink{&sink}
+{ }
+
+Writer::~Writer() noexcept {
+    flush();
+}
+
+bool Writer::null() noexcept {
+    separate();
+    append("null", 4);
+    return value_end();
+}
+
+bool Writer::boolean(Bool value) noexcept {
+    separate();
+
+    if (value) {
+        append("true", 4);
+    }
+    else {
+        append("false", 5);
+    }
+
+    return value_end();
+}
+
+bool Writer::number(const Number& value) noexcept {
+    separate();
+
+    if (value.is_raw()) {
+        append(value.raw().data(), value.raw().size());
+        return value_end();
+    }
+
+    switch (value.type()) {
+    case Number::INT:
+        integer((Int(value) < 0) ? (~Uint(Int(value)) + 1) : Uint(value),
+                Int(value) < 0);
+        break;
+    case Number::UINT:
+        integer(Uint(value), false);
+        break;
+    case Number::DOUBLE:
+        floating(Double(value));
+        break;
+    case Number::DECIMAL:
+        decimal(value);
+        break;
+    default:
+        break;
+    }
+
+    return value_end();
+}
+
+bool Writer::string(const StringView& value) noexcept {
+    separate();
+    quote(value);
+    return value_end();
+}
+
+bool Writer::key(const StringView& value) noexcept {
+    separate();
+    quote(value);
+    put(':');
+    m_separator = 0;
+    return !m_is_failed;
+}
+
+bool Writer::start_object() noexcept {
+    separate();
+    put('{');
+    ++m_depth;
+    m_separator = 0;
+    return !m_is_failed;
+}
+
+bool Writer::end_object() noexcept {
+    put('}');
+    --m_depth;
+    return value_end();
+}
+
+bool Writer::start_array() noexcept {
+    separate();
+    put('[');
+    ++m_depth;
+    m_separator = 0;
+    return !m_is_failed;
+}
+
+bool Writer::end_array() noexcept {
+    put(']');
+    --m_depth;
+    return value_end();
+}
+
+bool Writer::write(const Value& value) noexcept {
+    switch (value.type()) {
+    case Value::NIL:
+        null();
+        break;
+    case Value::BOOLEAN:
+        boolean(value.as_bool());
+        break;
+    case Value::NUMBER:
+        number(value.as_number());
+        break;
+    case Value::STRING:
+        string(value.as_string());
+        break;
+    case Value::ARRAY:
+        start_array();
+        for (const auto& item : value.as_array()) {
+            write(item);
+        }
+        end_array();
+        break;
+    case Value::OBJECT:
+        start_object();
+        for (const auto& pair : value.as_object()) {
+            key(pair.name());
+            write(pair.value());
+        }
+        end_object();
+        break;
+    default:
+        break;
+    }
+
+    return !m_is_failed;
+}
+
+bool Writer::flush() noexcept {
+    if (m_begin && !m_is_failed &&
+            !m_sink->commit(Size(m_position - m_begin))) {
+        m_is_failed = true;
+    }
+
+    m_begin = nullptr;
+    m_position = nullptr;
+    m_end = nullptr;
+
+    if (!m_is_failed && !m_sink->flush()) {
+        m_is_failed = true;
+    }
+
+    return !m_is_failed;
+}
+
+bool Writer::reserve(Size size) noexcept {
+    if (m_is_failed) {
+        return false;
+    }
+
+    Span<Char> space;
+
+    if (!m_begin || m_sink->commit(Size(m_position - m_begin))) {
+        space = m_sink->acquire(size);
+    }
+
+    if (!space.data() || (space.size() < size)) {
+        m_is_failed = true;
+        m_begin = nullptr;
+        m_position = nullptr;
+        m_end = nullptr;
+        return false;
+    }
+
+    m_begin = space.data();
+    m_position = m_begin;
+    m_end = m_begin + space.size();
+
+    return true;
+}
+
+void Writer::append(const Char* data, Size size) noexcept {
+    while (size) {
+        if ((m_position == m_end) && !reserve(1)) {
+            return;
+        }
+
+        auto count = std::min(size, Size(m_end - m_position));
+
+        m_position = std::copy_n(data, count, m_position);
+        data += count;
+        size -= count;
+    }
+}
+
+void Writer::separate() noexcept {
+    if (m_separator) {
+        put(m_separator);
+    }
+}
+
+bool Writer::value_end() noexcept {
+    m_separator = m_depth ? ',' : '\n';
+    return !m_is_failed;
+}
+
+void Writer::quote(const StringView& value) noexcept {
+    const auto* data = value.data();
+    auto size = value.size();
+    Size begin = 0;
+
+    put('"');
+
+    for (Size i = 0; i < size; ++i) {
+        auto ch = std::uint8_t(data[i]);
+        auto escape = ESCAPES[ch];
+
+        if (!escape) {
+            continue;
+        }
+
+        append(data + begin, i - begin);
+        begin = i + 1;
+
+        if ((Size(m_end - m_position) < ESCAPE_SIZE) &&
+                !reserve(ESCAPE_SIZE)) {
+            return;
+        }
+
+        *m_position++ = '\\';
+
+        if ('u' == escape) {
+            *m_position++ = 'u';
+            *m_position++ = '0';
+            *m_position++ = '0';
+            *m_position++ = HEX[ch >> 4];
+            *m_position++ = HEX[ch & 0xF];
+        }
+        else {
+            *m_position++ = escape;
+        }
+    }
+
+    append(data + begin, size - begin);
+    put('"');
+}
+
+void Writer::integer(Uint magnitude, bool is_negative) noexcept {
+    if ((Size(m_end - m_position) < NUMBER_SIZE) && !reserve(NUMBER_SIZE)) {
+        return;
+    }
+
+    if (is_negative) {
+        *m_position++ = '-';
+    }
+
+    m_position += floating::format(magnitude, m_position);
+}
+
+void Writer::floating(Double value) noexcept {
+    if (!std::isfinite(value)) {
+        append("null", 4);
+        return;
+    }
+
+    if ((Size(m_end - m_position) < NUMBER_SIZE) && !reserve(NUMBER_SIZE)) {
+        return;
+    }
+
+    m_position += floating::format(value, m_position);
+}
+
+void Writer::decimal(const Number& value) noexcept {
+    auto size = value.decimal_text(m_position, Size(m_end - m_position));
+
+    if (size > Size(m_end - m_position)) {
+        if (!reserve(size)) {
+            return;
+        }
+
+        size = value.decimal_text(m_position, size);
+    }
+
+    m_position += size;
+}
@@ -0,0 +1,166 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_atoms.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/atoms.hpp"
+#include "json/pair.hpp"
+#include "json/parser.hpp"
+#include "json/allocator/standard.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <cstring>
+
+using json::Atoms;
+using json::StringView;
+
+static StringView view(const std::string& str) {
+    return {str.data(), str.size()};
+}
+
+namespace {
+
+/* Standard allocations until the budget is spent */
+class Budget : public json::Allocator {
+public:
+    virtual ~Budget() noexcept override;
+
+    virtual void* allocate(json::Size size) noexcept override {
+        return budget ? (--budget, standard.allocate(size)) : nullptr;
+    }
+
+    virtual void* reallocate(void* ptr, json::Size size) noexcept override {
+        return budget ? (--budget, standard.reallocate(ptr, size)) : nullptr;
+    }
+
+    virtual void deallocate(void* ptr) noexcept override {
+        standard.deallocate(ptr);
+    }
+
+    virtual json::Size size(const void* ptr) const noexcept override {
+        return standard.size(ptr);
+    }
+
+    json::allocator::Standard standard{};
+    std::size_t budget{~std::size_t(0)};
+};
+
+Budget::~Budget() noexcept { }
+
+}
+
+TEST(TestAtoms, Intern) {
+    Atoms atoms;
+
+    std::string first{"name"};
+    std::string second{"name"};
+
+    auto atom = atoms.intern(view(first));
+
+    ASSERT_NE(nullptr, atom.data());
+    EXPECT_NE(first.data(), atom.data());
+    EXPECT_EQ(4u, atom.size());
+    EXPECT_EQ(0, std::memcmp("name", atom.data(), 5));
+
+    EXPECT_EQ(atom.data(), atoms.intern(view(second)).data());
+    EXPECT_EQ(atom.data(), atoms.find(view(second)).data());
+    EXPECT_EQ(nullptr, atoms.find(view("other")).data());
+    EXPECT_EQ(1u, atoms.size());
+
+    auto empty = atoms.intern(view(""));
+    ASSERT_NE(nullptr, empty.data());
+    EXPECT_EQ(0u, empty.size());
+    EXPECT_EQ(2u, atoms.size());
+}
+
+TEST(TestAtoms, Grow) {
+    json::allocator::Standard allocator;
+    Atoms atoms{allocator};
+    const char* data[1000];
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        data[i] = atoms.intern(view("key" + std::to_string(i))).data();
+        ASSERT_NE(nullptr, data[i]);
+    }
+
+    EXPECT_EQ(1000u, atoms.size());
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(data[i], atoms.find(view("key" + std::to_string(i))).data());
+    }
+}
+
+TEST(TestAtoms, FullTable) {
+    Budget allocator;
+    Atoms atoms{allocator};
+    const char* data[32];
+
+    /* Half of the first table, the next new atom has to grow it */
+    for (std::size_t i = 0; i < 32; ++i) {
+        data[i] = atoms.intern(view("key" + std::to_string(i))).data();
+        ASSERT_NE(nullptr, data[i]);
+    }
+
+    allocator.budget = 0;
+
+    for (std::size_t i = 0; i < 32; ++i) {
+        EXPECT_EQ(data[i], atoms.intern(view("key" + std::to_string(i))).data());
+    }
+
+    EXPECT_EQ(nullptr, atoms.intern(view("key32")).data());
+    EXPECT_EQ(32u, atoms.size());
+
+    allocator.budget = 2;
+
+    EXPECT_NE(nullptr, atoms.intern(view("key32")).data());
+    EXPECT_EQ(data[0], atoms.find(view("key0")).data());
+    EXPECT_EQ(33u, atoms.size());
+}
+
+TEST(TestAtoms, Parser) {
+    const char document[] =
+        R"([{"id": 1, "name": "a"}, {"name": "b", "id": 2}])";
+
+    json::allocator::Standard allocator;
+    Atoms atoms{allocator};
+    json::Parser parser{allocator, atoms};
+
+    ASSERT_EQ(json::Status::COMPLETE,
+            parser.parse(document, sizeof(document) - 1));
+
+    EXPECT_EQ(2u, atoms.size());
+
+    auto id = atoms.find(view("id"));
+    auto name = atoms.find(view("name"));
+
+    auto& array = parser.value().as_array();
+    auto& first = array.front().as_object();
+    auto& second = array.back().as_object();
+
+    EXPECT_TRUE(first.front().name().borrowed());
+    EXPECT_EQ(id.data(), first.front().name().data());
+    EXPECT_EQ(name.data(), first.back().name().data());
+    EXPECT_EQ(name.data(), second.front().name().data());
+    EXPECT_EQ(id.data(), second.back().name().data());
+}
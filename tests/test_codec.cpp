@@ -0,0 +1,215 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_codec.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/codec.hpp"
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+namespace rpc {
+
+struct Point {
+    std::int32_t x;
+    std::int32_t y;
+};
+
+struct Request {
+    std::uint64_t id;
+    std::string method;
+    bool is_async;
+    double timeout;
+    std::vector<Point> points;
+    std::map<std::string, std::vector<int>> params;
+};
+
+}
+
+JSON_FIELDS(rpc::Point, x, y)
+
+namespace {
+
+/* Refuses to hold more than four elements */
+template<typename T>
+struct Small {
+    using value_type = T;
+
+    Small() noexcept = default;
+
+    template<typename U>
+    Small(const Small<U>&) noexcept { }
+
+    T* allocate(std::size_t n) {
+        if (n > 4) {
+            throw std::bad_alloc{};
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p);
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const Small<T>&, const Small<U>&) noexcept { return true; }
+
+template<typename T, typename U>
+bool operator!=(const Small<T>&, const Small<U>&) noexcept { return false; }
+
+}
+JSON_FIELDS(rpc::Request, id, method, is_async, timeout, points, params)
+
+TEST(TestCodec, Hash) {
+    static_assert(json::key_hash("method") != json::key_hash("params"), "");
+
+    const char key[] = "method";
+
+    EXPECT_EQ(json::key_hash("method"),
+            json::key_hash(json::StringView{key, sizeof(key) - 1}));
+}
+
+TEST(TestCodec, Struct) {
+    const char document[] = R"({
+        "id": 42,
+        "method": "move\n",
+        "unknown": {"nested": [1, {"a": null}], "x": 3},
+        "is_async": true,
+        "timeout": 1.5e-1,
+        "points": [{"x": -1, "y": 2}, {"y": 4, "x": 3, "z": []}],
+        "params": {"a": [1, 2], "b": []}
+    })";
+
+    rpc::Request request{};
+
+    ASSERT_TRUE(json::decode(document, sizeof(document) - 1, request));
+
+    EXPECT_EQ(42u, request.id);
+    EXPECT_EQ("move\n", request.method);
+    EXPECT_TRUE(request.is_async);
+    EXPECT_DOUBLE_EQ(0.15, request.timeout);
+
+    ASSERT_EQ(2u, request.points.size());
+    EXPECT_EQ(-1, request.points[0].x);
+    EXPECT_EQ(2, request.points[0].y);
+    EXPECT_EQ(3, request.points[1].x);
+    EXPECT_EQ(4, request.points[1].y);
+
+    ASSERT_EQ(2u, request.params.size());
+    EXPECT_EQ((std::vector<int>{1, 2}), request.params["a"]);
+    EXPECT_TRUE(request.params["b"].empty());
+}
+
+TEST(TestCodec, MissingFields) {
+    const char document[] = R"({"y": 7})";
+
+    rpc::Point point{1, 2};
+
+    ASSERT_TRUE(json::decode(document, sizeof(document) - 1, point));
+
+    EXPECT_EQ(1, point.x);
+    EXPECT_EQ(7, point.y);
+}
+
+TEST(TestCodec, Containers) {
+    const char document[] = R"([[true, false], [], [true]])";
+
+    std::vector<std::vector<bool>> value;
+
+    ASSERT_TRUE(json::decode(document, sizeof(document) - 1, value));
+
+    ASSERT_EQ(3u, value.size());
+    EXPECT_EQ((std::vector<bool>{true, false}), value[0]);
+    EXPECT_TRUE(value[1].empty());
+    EXPECT_EQ((std::vector<bool>{true}), value[2]);
+}
+
+TEST(TestCodec, Invalid) {
+    const char* documents[] = {
+        R"({"x": "1", "y": 2})",
+        R"({"x": 1.5})",
+        R"({"x": 4294967296})",
+        R"({"x": -2147483649})",
+        R"([1, 2])",
+        R"({"x": 1, "y": 2)",
+        R"({"x": 1} {})",
+        R"({"x": 1,})"
+    };
+
+    for (const auto* document : documents) {
+        rpc::Point point{};
+        EXPECT_FALSE(json::decode(document, std::strlen(document), point))
+            << document;
+    }
+
+    std::uint8_t byte{};
+    EXPECT_FALSE(json::decode("256", 3, byte));
+    EXPECT_FALSE(json::decode("-1", 2, byte));
+    EXPECT_TRUE(json::decode("255", 3, byte));
+    EXPECT_EQ(255u, byte);
+}
+
+TEST(TestCodec, Maps) {
+    const char document[] = R"({"a": [1], "b": [], "a": [2, 3]})";
+
+    std::map<std::string, std::vector<int>> ordered;
+    std::unordered_map<std::string, std::vector<int>> unordered;
+
+    ASSERT_TRUE(json::decode(document, sizeof(document) - 1, ordered));
+    ASSERT_TRUE(json::decode(document, sizeof(document) - 1, unordered));
+
+    EXPECT_EQ(2u, ordered.size());
+    EXPECT_EQ((std::vector<int>{2, 3}), ordered["a"]);
+    EXPECT_TRUE(ordered["b"].empty());
+    EXPECT_EQ(2u, unordered.size());
+    EXPECT_EQ((std::vector<int>{2, 3}), unordered["a"]);
+
+    EXPECT_FALSE(json::decode("[]", 2, ordered));
+}
+
+#if defined(__cpp_exceptions)
+TEST(TestCodec, OutOfMemory) {
+    const char document[] = R"({"x": [1, 2, 3, 4, 5]})";
+
+    std::map<std::string, std::vector<int, Small<int>>> value;
+    json::Reader reader{document, sizeof(document) - 1};
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_FALSE(json::decode(reader, value));
+    EXPECT_EQ(json::Status::ERROR, reader.status());
+    EXPECT_EQ(json::ParseError::OUT_OF_MEMORY, reader.error().code());
+    EXPECT_FALSE(reader.next());
+
+    const char small[] = R"({"x": [1, 2, 3, 4]})";
+
+    EXPECT_TRUE(json::decode(small, sizeof(small) - 1, value));
+    EXPECT_EQ(4u, value["x"].size());
+}
+#endif
@@ -0,0 +1,185 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_document.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/document.hpp"
+#include "json/pair.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <cstring>
+
+using json::Value;
+using json::Status;
+using json::Document;
+using json::LazyValue;
+
+static std::string to_string(const json::String& str) {
+    return {str.data(), str.size()};
+}
+
+static Status parse(Document& document, const char* str) {
+    return document.parse(str, std::strlen(str));
+}
+
+TEST(TestDocument, Object) {
+    Document document;
+
+    ASSERT_EQ(Status::COMPLETE, parse(document, R"( {
+        "skip": {"a": [1, 2, {"}": "]"}], "b": "x\"y"},
+        "id": 42, "name": "router", "ok": true,
+        "list": [1.5, "two", null, []],
+        "es\u0063aped": -1
+    } )"));
+
+    auto root = document.root();
+
+    ASSERT_TRUE(root.is_object());
+    EXPECT_EQ(6, root.size());
+    EXPECT_EQ(42, json::Int(root["id"].as_number()));
+    EXPECT_EQ("router", to_string(root["name"].as_string()));
+    EXPECT_TRUE(root["ok"].as_bool());
+    EXPECT_EQ(-1, json::Int(root["escaped"].as_number()));
+    EXPECT_FALSE(root["missing"].is_valid());
+    EXPECT_FALSE(root["a"].is_valid());
+
+    auto list = root["list"];
+
+    ASSERT_TRUE(list.is_array());
+    EXPECT_EQ(4, list.size());
+    EXPECT_DOUBLE_EQ(1.5, json::Double(list[0].as_number()));
+    EXPECT_EQ("two", to_string(list[1].as_string()));
+    EXPECT_TRUE(list[2].is_null());
+    EXPECT_TRUE(list[3].is_array());
+    EXPECT_EQ(0, list[3].size());
+    EXPECT_FALSE(list[4].is_valid());
+
+    auto skip = root["skip"]["a"][2];
+
+    ASSERT_TRUE(skip.is_object());
+    EXPECT_EQ(R"({"}": "]"})", std::string(skip.raw().data(),
+                skip.raw().size()));
+    EXPECT_EQ("]", to_string(skip["}"].as_string()));
+    EXPECT_EQ("x\"y", to_string(root["skip"]["b"].as_string()));
+}
+
+TEST(TestDocument, ToValue) {
+    Document document;
+
+    ASSERT_EQ(Status::COMPLETE, parse(document, R"({"a": {"b": [1, 2]}})"));
+
+    auto value = document.root()["a"].to_value();
+
+    ASSERT_TRUE(value.is_object());
+    const auto& array = value.as_object().front().value();
+    ASSERT_TRUE(array.is_array());
+    EXPECT_EQ(2, array.size());
+    EXPECT_EQ(&value, array.parent());
+}
+
+TEST(TestDocument, Scalar) {
+    Document document;
+
+    ASSERT_EQ(Status::COMPLETE, parse(document, " 12 "));
+    EXPECT_EQ(12, json::Int(document.root().as_number()));
+}
+
+TEST(TestDocument, Invalid) {
+    Document document;
+
+    EXPECT_EQ(Status::ERROR, parse(document, "[1, 2"));
+    EXPECT_EQ(Status::ERROR, parse(document, "[1, 2}"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"({"a": "b})"));
+    EXPECT_EQ(Status::ERROR, parse(document, "[] []"));
+    EXPECT_EQ(Status::ERROR, parse(document, "  "));
+    EXPECT_EQ(Status::ERROR, parse(document, "[1 2]"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"({"a" 1})"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"({"a": 1 "b": 2})"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"({"a": 1,})"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"({1: 2})"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"(["a" "b"])"));
+    EXPECT_EQ(Status::ERROR, parse(document, R"(["a"1])"));
+    EXPECT_EQ(Status::ERROR, parse(document, "[1, , 2]"));
+    EXPECT_EQ(Status::ERROR, parse(document, "[1: 2]"));
+    EXPECT_EQ(Status::ERROR, parse(document, "[,]"));
+    EXPECT_EQ(Status::ERROR, parse(document, "[][]"));
+    EXPECT_EQ(Status::ERROR, parse(document, "1 2"));
+    EXPECT_EQ(Status::ERROR, parse(document, "1,"));
+
+    /* Values are validated once they are accessed */
+    ASSERT_EQ(Status::COMPLETE, parse(document, "[1x, 2]"));
+    EXPECT_TRUE(document.root()[0].is_number());
+    EXPECT_EQ(json::Number{}, document.root()[0].as_number());
+    EXPECT_EQ(2, json::Int(document.root()[1].as_number()));
+
+    ASSERT_EQ(Status::COMPLETE, parse(document, "[tru]"));
+    EXPECT_TRUE(document.root()[0].is_bool());
+    EXPECT_FALSE(document.root()[0].as_bool());
+    EXPECT_TRUE(document.root()[0].to_value().is_null());
+}
+
+TEST(TestDocument, Get) {
+    Document document;
+
+    ASSERT_EQ(Status::COMPLETE,
+            parse(document, R"([false, tru, 1.5, 1x, "s\"", "\x", 2])"));
+
+    auto root = document.root();
+    json::Bool boolean{true};
+    json::Number number{};
+    json::String string{};
+
+    EXPECT_TRUE(root[0].get(boolean));
+    EXPECT_FALSE(boolean);
+
+    boolean = true;
+    EXPECT_FALSE(root[1].get(boolean));
+    EXPECT_TRUE(boolean);
+
+    EXPECT_TRUE(root[2].get(number));
+    EXPECT_EQ(1.5, json::Double(number));
+    EXPECT_FALSE(root[3].get(number));
+    EXPECT_EQ(1.5, json::Double(number));
+
+    EXPECT_TRUE(root[4].get(string));
+    EXPECT_EQ("s\"", std::string(string.data(), string.size()));
+    EXPECT_FALSE(root[5].get(string));
+
+    /* Wrong types don't match either */
+    EXPECT_FALSE(root[6].get(boolean));
+    EXPECT_FALSE(root[6].get(string));
+    EXPECT_FALSE(LazyValue{}.get(number));
+}
+
+TEST(TestDocument, Separators) {
+    Document document;
+    std::string text{R"({"a":[1,"x",{"b":null}],"c":"d\"e" , "f" :-2.5e1})"};
+
+    /* Spread over blocks, so scalars cross block boundaries */
+    text.insert(text.find("-2.5e1"), 60, ' ');
+
+    ASSERT_EQ(Status::COMPLETE, parse(document, text.c_str()));
+    EXPECT_EQ(-25.0, json::Double(document.root()["f"].as_number()));
+    EXPECT_EQ(3, document.root()["a"].size());
+}
@@ -0,0 +1,213 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_limits.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/limits.hpp"
+#include "json/parser.hpp"
+#include "json/allocator/limited.hpp"
+#include "json/allocator/standard.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+using json::Limits;
+using json::Parser;
+using json::ParseError;
+
+static ParseError parse(const Limits& limits, const std::string& document) {
+    json::allocator::Standard allocator;
+    Parser parser{allocator};
+
+    parser.set_limits(limits);
+    parser.parse(document.data(), document.size());
+    parser.finish();
+
+    return parser.error();
+}
+
+TEST(TestLimits, Depth) {
+    Limits limits;
+    limits.depth = 3;
+
+    EXPECT_FALSE(parse(limits, R"([{"a": [1]}, [2]])"));
+
+    auto error = parse(limits, R"([{"a": [[1]]}])");
+
+    EXPECT_EQ(ParseError::DEPTH_LIMIT, error.code());
+    EXPECT_EQ(8, error.offset());
+}
+
+TEST(TestLimits, StringLength) {
+    Limits limits;
+    limits.string_length = 4;
+
+    EXPECT_FALSE(parse(limits, R"({"abcd": "a\nbc"})"));
+    EXPECT_EQ(ParseError::STRING_LIMIT,
+            parse(limits, R"({"abcde": 1})").code());
+    EXPECT_EQ(ParseError::STRING_LIMIT,
+            parse(limits, R"(["ab\ncd"])").code());
+    EXPECT_EQ(ParseError::STRING_LIMIT,
+            parse(limits, "[\"" + std::string(1000, 'x') + "\"]").code());
+
+    auto error = parse(limits, R"(["abcdefghijklmnopqrstuvwxyz"])");
+
+    EXPECT_EQ(ParseError::STRING_LIMIT, error.code());
+    EXPECT_EQ(6, error.offset());
+    EXPECT_EQ(7, error.column());
+
+    json::allocator::Standard allocator;
+    Parser bytes{allocator};
+
+    bytes.set_limits(limits);
+
+    for (auto ch : std::string{R"(["abcdefghijklmnopqrstuvwxyz"])"}) {
+        bytes.put(ch);
+    }
+
+    EXPECT_EQ(ParseError::STRING_LIMIT, bytes.error().code());
+    EXPECT_EQ(6, bytes.error().offset());
+
+    error = parse(limits, R"(["ab\ncdefghijklmnopqrstuvwxyz"])");
+
+    EXPECT_EQ(ParseError::STRING_LIMIT, error.code());
+    EXPECT_EQ(7, error.offset());
+
+    EXPECT_FALSE(parse(limits, "[1234567, -1.2345e-67, " +
+                std::string(1000, '9') + "]"));
+}
+
+TEST(TestLimits, Members) {
+    Limits limits;
+    limits.members = 2;
+
+    EXPECT_FALSE(parse(limits, R"({"a": {"b": 1, "c": 2}, "d": [{}, {}]})"));
+
+    auto error = parse(limits, R"([{"a": 1, "b": 2}, {"a": 1, "b": 2, "c": 3}])");
+
+    EXPECT_EQ(ParseError::MEMBERS_LIMIT, error.code());
+    EXPECT_EQ(36, error.offset());
+
+    std::string deep;
+
+    for (int i = 0; i < 100; ++i) {
+        deep += R"({"a": 1, "b": )";
+    }
+
+    deep += "0" + std::string(100, '}');
+
+    EXPECT_FALSE(parse(limits, deep));
+}
+
+TEST(TestLimits, Reused) {
+    json::allocator::Standard allocator;
+    Parser parser{allocator};
+    Limits limits;
+    limits.members = 10;
+
+    parser.set_limits(limits);
+
+    EXPECT_EQ(json::Status::COMPLETE, parser.parse(R"({"a": [1]})", 10));
+
+    std::string deep = std::string(100, '[') + std::string(100, ']');
+
+    parser.set_limits(Limits{});
+    parser.restart();
+
+    EXPECT_EQ(json::Status::COMPLETE, parser.parse(deep.data(), deep.size()));
+
+    parser.set_limits(limits);
+    parser.restart();
+
+    deep = std::string(100, '[') + R"({"a": 1, "b": 2})" +
+        std::string(100, ']');
+
+    EXPECT_EQ(json::Status::COMPLETE, parser.parse(deep.data(), deep.size()));
+}
+
+TEST(TestLimits, DocumentSize) {
+    Limits limits;
+    limits.document_size = 8;
+
+    EXPECT_EQ(ParseError::DOCUMENT_LIMIT, parse(limits, "[1, 2, 3]").code());
+    EXPECT_FALSE(parse(limits, "[1, 2]  "));
+
+    json::allocator::Standard allocator;
+    Parser parser{allocator};
+
+    parser.set_limits(limits);
+
+    EXPECT_EQ(json::Status::NEED_MORE, parser.parse("[1,\n ", 5));
+    EXPECT_EQ(json::Status::ERROR, parser.parse("2, 3]", 5));
+
+    auto error = parser.error();
+
+    EXPECT_EQ(ParseError::DOCUMENT_LIMIT, error.code());
+    EXPECT_EQ(8, error.offset());
+    EXPECT_EQ(2, error.line());
+    EXPECT_EQ(5, error.column());
+
+    Parser bytes{allocator};
+
+    bytes.set_limits(limits);
+
+    for (auto ch : std::string{"[1, 2, 3]"}) {
+        bytes.put(ch);
+    }
+
+    EXPECT_EQ(ParseError::DOCUMENT_LIMIT, bytes.error().code());
+    EXPECT_EQ(8, bytes.error().offset());
+}
+
+TEST(TestLimits, Allocated) {
+    json::allocator::Standard standard;
+    json::allocator::Limited limited{standard, 4096};
+
+    std::string document{"["};
+
+    for (int i = 0; i < 1000; ++i) {
+        document += "\"item\", ";
+    }
+
+    document += "1]";
+
+    {
+        Parser parser{limited};
+
+        EXPECT_EQ(json::Status::ERROR,
+                parser.parse(document.data(), document.size()));
+        EXPECT_EQ(ParseError::OUT_OF_MEMORY, parser.error().code());
+        EXPECT_LE(limited.allocated(), limited.limit());
+    }
+
+    EXPECT_EQ(0, limited.allocated());
+
+    {
+        Parser parser{limited};
+
+        EXPECT_EQ(json::Status::COMPLETE, parser.parse("[\"a\", {}]", 9));
+        EXPECT_NE(0, limited.allocated());
+    }
+
+    EXPECT_EQ(0, limited.allocated());
+}
@@ -0,0 +1,146 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_lines_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/lines_parser.hpp"
+
+#include "gtest/gtest.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using json::LinesParser;
+
+namespace {
+
+class Collector : public LinesParser::Observer {
+public:
+    virtual ~Collector() noexcept override;
+
+    virtual void record_parsed(json::Size offset,
+            json::Value& value) noexcept override {
+        std::lock_guard<std::mutex> lock{mutex};
+        offsets.push_back(offset);
+        ids[offset] = json::Int(value);
+    }
+
+    virtual void record_parsed(json::Size offset,
+            json::Size error_offset) noexcept override {
+        std::lock_guard<std::mutex> lock{mutex};
+        offsets.push_back(offset);
+        errors[offset] = error_offset;
+    }
+
+    std::mutex mutex{};
+    std::vector<json::Size> offsets{};
+    std::map<json::Size, json::Int> ids{};
+    std::map<json::Size, json::Size> errors{};
+};
+
+Collector::~Collector() noexcept { }
+
+}
+
+static std::string generate(std::size_t count,
+        std::vector<json::Size>& offsets) {
+    std::string lines;
+
+    for (std::size_t id = 0; id < count; ++id) {
+        offsets.push_back(lines.size());
+        lines += std::to_string(id) + "\n";
+
+        if (0 == (id % 7)) {
+            lines += "  \r\n";
+        }
+    }
+
+    return lines;
+}
+
+TEST(TestLinesParser, Ordered) {
+    std::vector<json::Size> offsets;
+    auto lines = generate(5000, offsets);
+
+    Collector collector;
+    LinesParser parser{collector, LinesParser::ORDERED, 4, 256};
+    parser.parse(lines.data(), lines.size());
+
+    ASSERT_EQ(offsets, collector.offsets);
+    EXPECT_TRUE(collector.errors.empty());
+
+    for (std::size_t id = 0; id < offsets.size(); ++id) {
+        EXPECT_EQ(json::Int(id), collector.ids[offsets[id]]);
+    }
+}
+
+TEST(TestLinesParser, Unordered) {
+    std::vector<json::Size> offsets;
+    auto lines = generate(5000, offsets);
+
+    Collector collector;
+    LinesParser parser{collector, LinesParser::UNORDERED, 4, 100};
+    parser.parse(lines.data(), lines.size());
+
+    EXPECT_EQ(offsets.size(), collector.ids.size());
+    EXPECT_TRUE(collector.errors.empty());
+
+    for (std::size_t id = 0; id < offsets.size(); ++id) {
+        EXPECT_EQ(json::Int(id), collector.ids[offsets[id]]);
+    }
+}
+
+TEST(TestLinesParser, Errors) {
+    const std::string lines{"{\"a\": [1, {}]}\n[1, 2\n\"x\" ]\n{\"b\" 2}"};
+
+    Collector collector;
+    LinesParser parser{collector, LinesParser::ORDERED, 2, 4};
+    parser.parse(lines.data(), lines.size());
+
+    const std::vector<json::Size> expected{0, 15, 21, 27};
+
+    EXPECT_EQ(expected, collector.offsets);
+    EXPECT_EQ(3, collector.errors.size());
+    EXPECT_EQ(20, collector.errors[15]);
+    EXPECT_EQ(25, collector.errors[21]);
+    EXPECT_EQ(32, collector.errors[27]);
+}
+
+TEST(TestLinesParser, ErrorsInBatch) {
+    const std::string lines{
+        "[1, [2, \"ab\n7\n{\"k\": [1\n8\n\"\\u12\n9\n[1,]\n10"};
+
+    Collector collector;
+    LinesParser parser{collector, LinesParser::ORDERED, 1, 0};
+    parser.parse(lines.data(), lines.size());
+
+    const std::vector<json::Size> expected{0, 12, 14, 23, 25, 31, 33, 38};
+
+    EXPECT_EQ(expected, collector.offsets);
+    EXPECT_EQ(4, collector.errors.size());
+    EXPECT_EQ(7, collector.ids[12]);
+    EXPECT_EQ(8, collector.ids[23]);
+    EXPECT_EQ(9, collector.ids[31]);
+    EXPECT_EQ(10, collector.ids[38]);
+}
@@ -0,0 +1,135 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_mapped_file.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/mapped_file.hpp"
+#include "json/pair.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <cstdio>
+#include <fstream>
+
+using json::MappedFile;
+using json::Status;
+
+static const char FILENAME[]{"test_mapped_file.json"};
+
+static void write(const std::string& content) {
+    std::ofstream{FILENAME, std::ios::binary} << content;
+}
+
+TEST(TestMappedFile, Map) {
+    write(R"({"key": "va\"lue", "list": [1, 2]})");
+
+    MappedFile file{FILENAME};
+
+    ASSERT_TRUE(file.is_open());
+    EXPECT_EQ(34, file.size());
+    EXPECT_EQ('{', file.data()[0]);
+
+    MappedFile moved{std::move(file)};
+
+    EXPECT_FALSE(file.is_open());
+    EXPECT_TRUE(moved.is_open());
+
+    moved.close();
+    EXPECT_FALSE(moved.is_open());
+    EXPECT_FALSE(moved.open("missing_test_mapped_file.json"));
+
+    std::remove(FILENAME);
+}
+
+TEST(TestMappedFile, ParseFile) {
+    write(R"({"key": "va\"lue", "list": [1, 2]})");
+
+    json::Parser parser;
+
+    ASSERT_EQ(Status::COMPLETE, json::parse_file(FILENAME, parser));
+
+    auto& object = parser.value().as_object();
+    EXPECT_EQ(2, object.size());
+    EXPECT_EQ(2, object.back().value().size());
+
+    /* Reused parser doesn't keep its last result */
+    EXPECT_EQ(Status::ERROR,
+            json::parse_file("missing_test_mapped_file.json", parser));
+    EXPECT_EQ(json::ParseError::FILE_ERROR, parser.error().code());
+
+    MappedFile closed;
+    json::Parser other;
+    EXPECT_EQ(Status::ERROR, json::parse_file(closed, other));
+    EXPECT_EQ(json::ParseError::FILE_ERROR, other.error().code());
+
+    std::remove(FILENAME);
+}
+
+TEST(TestMappedFile, Empty) {
+    write("");
+
+    MappedFile file{FILENAME};
+
+    EXPECT_TRUE(file.is_open());
+    EXPECT_EQ(0, file.size());
+
+    json::Parser parser;
+
+    EXPECT_EQ(Status::ERROR, json::parse_file(FILENAME, parser));
+    EXPECT_EQ(json::ParseError::UNEXPECTED_END, parser.error().code());
+
+    json::Parser in_situ;
+
+    EXPECT_EQ(Status::ERROR, json::parse_file(file, in_situ));
+    EXPECT_EQ(json::ParseError::UNEXPECTED_END, in_situ.error().code());
+
+    std::remove(FILENAME);
+}
+
+TEST(TestMappedFile, Truncated) {
+    write(R"({"key": "unterminated)");
+
+    MappedFile file{FILENAME};
+    json::Parser parser;
+
+    EXPECT_EQ(Status::ERROR, json::parse_file(file, parser));
+    EXPECT_EQ(json::ParseError::UNEXPECTED_END, parser.error().code());
+
+    std::remove(FILENAME);
+}
+
+TEST(TestMappedFile, InSitu) {
+    write(R"(["in \"situ\"", {"a": null}])");
+
+    MappedFile file{FILENAME};
+    json::Parser parser;
+
+    ASSERT_EQ(Status::COMPLETE, json::parse_file(file, parser));
+
+    auto& string = parser.value().as_array().front().as_string();
+    EXPECT_EQ("in \"situ\"", std::string(string.data(), string.size()));
+    EXPECT_GE(string.data(), file.data());
+    EXPECT_LT(string.data(), file.data() + file.size());
+
+    std::remove(FILENAME);
+}
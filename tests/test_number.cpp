@@ -0,0 +1,178 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file test_number.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/number.hpp"
+#include "json/parser.hpp"
+#include "json/value.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <cstring>
+#include <utility>
+
+using json::Number;
+using json::Int;
+using json::Uint;
+using json::Double;
+
+static Number decimal(const char* text) {
+    return Number{json::StringView{text, std::strlen(text)}};
+}
+
+static std::string to_string(const Number& number) {
+    char buffer[256];
+    auto size = number.decimal_text(buffer, sizeof(buffer));
+    return std::string{buffer, size};
+}
+
+TEST(TestNumber, DecimalText) {
+    const char* texts[]{
+        "123456789012345678901234567890.123456",
+        "0.10",
+        "-0.000012",
+        "100",
+        "0",
+        "1e400",
+        "15e-21",
+        "-98765432109876543210987654321098765432109876543210.5"
+    };
+
+    for (const auto* text : texts) {
+        auto number = decimal(text);
+        EXPECT_TRUE(number.is_decimal()) << text;
+        EXPECT_EQ(text, to_string(number));
+    }
+
+    EXPECT_EQ("15e-21", to_string(decimal("1.5e-20")));
+    EXPECT_EQ("12e2", to_string(decimal("1.2E+3")));
+    EXPECT_EQ("0.00", to_string(decimal("-0.00")));
+
+    char small[4];
+    EXPECT_EQ(5, decimal("-0.10").decimal_text(small, sizeof(small)));
+}
+
+TEST(TestNumber, DecimalArithmetic) {
+    auto sum = decimal("0.1") + decimal("0.2");
+
+    EXPECT_TRUE(sum.is_decimal());
+    EXPECT_EQ("0.3", to_string(sum));
+    EXPECT_EQ(decimal("0.30"), sum);
+
+    EXPECT_EQ("-0.75", to_string(decimal("1.5") - decimal("2.25")));
+    EXPECT_EQ("246913578024691357802469135780",
+            to_string(decimal("123456789012345678901234567890") * Number{2}));
+    EXPECT_EQ("1.0000000000000000000000000000000000000001",
+            to_string(decimal("1e-40") + Number{1u}));
+    EXPECT_EQ("2.5", to_string(decimal("0.5") + Number{2}));
+    EXPECT_EQ("-6.25", to_string(decimal("2.5") * decimal("-2.5")));
+    EXPECT_DOUBLE_EQ(0.5, Double(decimal("1") / Number{2}));
+
+    auto counter = decimal("99999999999999999999.9");
+    ++counter;
+    EXPECT_EQ("100000000000000000000.9", to_string(counter));
+}
+
+TEST(TestNumber, DecimalCompare) {
+    EXPECT_LT(Number{std::numeric_limits<Uint>::max()},
+            decimal("100000000000000000000"));
+    EXPECT_LT(decimal("-1.5"), Number{-1});
+    EXPECT_GT(decimal("0.000000001"), Number{0});
+    EXPECT_EQ(decimal("1e3"), Number{1000});
+    EXPECT_EQ(decimal("1e3"), decimal("1000.000"));
+    EXPECT_NE(decimal("1e3"), decimal("1000.001"));
+    EXPECT_LT(decimal("1e-100"), decimal("1e100"));
+    EXPECT_FALSE(decimal("0.0"));
+    EXPECT_TRUE(decimal("0.01"));
+}
+
+TEST(TestNumber, DecimalConversion) {
+    EXPECT_EQ(-42, Int(decimal("-42.9")));
+    EXPECT_EQ(1000u, Uint(decimal("1e3")));
+    EXPECT_EQ(0, Int(decimal("0.5")));
+    EXPECT_DOUBLE_EQ(0.1, Double(decimal("0.1")));
+    EXPECT_DOUBLE_EQ(-1.5e300, Double(decimal("-1.5e300")));
+    EXPECT_DOUBLE_EQ(1.2345678901234568e29,
+            Double(decimal("123456789012345678901234567890")));
+    EXPECT_TRUE(decimal("1e1000000").is_floating_point());
+}
+
+TEST(TestNumber, DecimalCopy) {
+    const char* text = "1234567890123456789012345678901234567890.0987654321";
+    auto number = decimal(text);
+
+    Number copy{number};
+    Number moved{std::move(number)};
+
+    EXPECT_EQ(text, to_string(copy));
+    EXPECT_EQ(text, to_string(moved));
+    EXPECT_FALSE(number.is_decimal());
+
+    number = copy;
+    copy = Number{1};
+    EXPECT_EQ(text, to_string(number));
+    EXPECT_EQ(1, Int(copy));
+
+    json::Value value{moved};
+    json::Value value_copy{value};
+    EXPECT_EQ(text, to_string(value_copy.as_number()));
+}
+
+TEST(TestNumber, DecimalParser) {
+    const char document[] =
+        "[1, -2, 0.10, 123456789012345678901234567890, 1e2]";
+
+    json::Parser parser;
+    parser.set_decimal_numbers(true);
+
+    ASSERT_EQ(json::Status::COMPLETE,
+            parser.parse(document, sizeof(document) - 1));
+
+    auto it = parser.value().as_array().cbegin();
+
+    EXPECT_EQ(Number::UINT, it->as_number().type());
+    ++it;
+    EXPECT_EQ(Number::INT, it->as_number().type());
+    ++it;
+    EXPECT_EQ("0.10", to_string(it->as_number()));
+    ++it;
+    EXPECT_EQ("123456789012345678901234567890", to_string(it->as_number()));
+    ++it;
+    EXPECT_EQ("1e2", to_string(it->as_number()));
+
+    char in_situ[] = "[0.25, 7]";
+    json::Parser raw;
+    raw.set_raw_numbers(true);
+    raw.set_decimal_numbers(true);
+
+    ASSERT_EQ(json::Status::COMPLETE,
+            raw.parse_in_situ(in_situ, sizeof(in_situ) - 1));
+
+    const auto& first = raw.value().as_array().front().as_number();
+    EXPECT_TRUE(first.is_raw());
+    EXPECT_EQ(Number::DECIMAL, first.type());
+    EXPECT_EQ(decimal("0.25"), first);
+    EXPECT_EQ("0.50", to_string(first + first));
+}
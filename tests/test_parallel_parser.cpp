@@ -0,0 +1,126 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_parallel_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/parallel_parser.hpp"
+#include "json/pair.hpp"
+#include "json/allocator/standard.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+using json::ParallelParser;
+using json::Status;
+
+static std::string generate(std::size_t count) {
+    std::string document{" ["};
+
+    for (std::size_t id = 0; id < count; ++id) {
+        auto number = std::to_string(id);
+
+        if (id) {
+            document += ",\n";
+        }
+
+        document += "{\"id\": " + number + ", \"tags\": [\"a,]\", [" +
+            number + "]]}";
+    }
+
+    document += "] ";
+
+    return document;
+}
+
+TEST(TestParallelParser, Array) {
+    json::allocator::Standard allocator;
+    ParallelParser parser{allocator, 4, 64};
+
+    auto document = generate(1000);
+
+    ASSERT_EQ(Status::COMPLETE, parser.parse(document.data(),
+                document.size()));
+
+    auto& value = parser.value();
+    ASSERT_TRUE(value.is_array());
+    ASSERT_EQ(1000, value.size());
+
+    json::Int id = 0;
+
+    for (auto& item : value.as_array()) {
+        EXPECT_EQ(&value, item.parent());
+        auto& object = item.as_object();
+        EXPECT_EQ(id, json::Int(object.front().value()));
+        EXPECT_EQ(id, json::Int(object.back().value().as_array().back()
+                    .as_array().front()));
+        ++id;
+    }
+}
+
+TEST(TestParallelParser, Arenas) {
+    ParallelParser parser{4, 64};
+
+    for (auto count : {1000, 10}) {
+        auto document = generate(json::Size(count));
+
+        ASSERT_EQ(Status::COMPLETE, parser.parse(document.data(),
+                    document.size()));
+
+        auto& value = parser.value();
+        ASSERT_EQ(count, value.size());
+        EXPECT_EQ(count - 1, json::Int(value.as_array().back()
+                    .as_object().front().value()));
+    }
+}
+
+TEST(TestParallelParser, Sequential) {
+    json::allocator::Standard allocator;
+    ParallelParser parser{allocator, 4, 4};
+
+    const std::string document{R"({"a": [1, 2, 3, 4, 5, 6, 7, 8]})"};
+
+    ASSERT_EQ(Status::COMPLETE, parser.parse(document.data(),
+                document.size()));
+    EXPECT_TRUE(parser.value().is_object());
+    EXPECT_EQ(8, parser.value().as_object().front().value().size());
+}
+
+TEST(TestParallelParser, Errors) {
+    json::allocator::Standard allocator;
+    ParallelParser parser{allocator, 8, 2};
+
+    const std::string empty{"[1, 2, 3,, 5, 6, 7, 8, 9]"};
+    EXPECT_EQ(Status::ERROR, parser.parse(empty.data(), empty.size()));
+    EXPECT_EQ(9, parser.offset());
+
+    const std::string trailing{"[1, 2, 3, 4, 5, 6, 7, 8, ]"};
+    EXPECT_EQ(Status::ERROR, parser.parse(trailing.data(), trailing.size()));
+    EXPECT_EQ(25, parser.offset());
+
+    const std::string invalid{"[1, 2, 3, 4, tru, 6, 7, 8, 9]"};
+    EXPECT_EQ(Status::ERROR, parser.parse(invalid.data(), invalid.size()));
+    EXPECT_EQ(16, parser.offset());
+
+    const std::string unclosed{"[1, 2, 3, 4, 5, 6, 7, 8, 9"};
+    EXPECT_EQ(Status::ERROR, parser.parse(unclosed.data(), unclosed.size()));
+}
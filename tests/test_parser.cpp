@@ -0,0 +1,787 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/parser.hpp"
+#include "json/pair.hpp"
+#include "json/allocator/standard.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <string>
+#include <cstdint>
+#include <memory>
+#include <cstring>
+
+using json::Value;
+using json::Parser;
+using json::Number;
+using json::Int;
+using json::Double;
+
+static std::string to_string(const json::String& str) {
+    return {str.data(), str.size()};
+}
+
+static void parse(Parser& parser, const char* str) {
+    parser.parse(str, std::strlen(str));
+}
+
+TEST(TestParser, EmptyArray) {
+    Parser parser;
+
+    parse(parser, "[]");
+
+    ASSERT_TRUE(parser.value().is_array());
+    EXPECT_EQ(0, parser.value().size());
+}
+
+TEST(TestParser, EmptyObject) {
+    Parser parser;
+
+    parse(parser, " { } ");
+
+    ASSERT_TRUE(parser.value().is_object());
+    EXPECT_EQ(0, parser.value().size());
+}
+
+TEST(TestParser, Literals) {
+    Parser parser;
+
+    parse(parser, "[null, true, false]");
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(3, array.size());
+    auto it = array.cbegin();
+    EXPECT_TRUE(it->is_null());
+    ++it;
+    ASSERT_TRUE(it->is_bool());
+    EXPECT_TRUE(it->as_bool());
+    ++it;
+    ASSERT_TRUE(it->is_bool());
+    EXPECT_FALSE(it->as_bool());
+}
+
+TEST(TestParser, Numbers) {
+    Parser parser;
+
+    parse(parser, "[0, 42, -7, 1.5, -2.5e2, 25E-1]");
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(6, array.size());
+    auto it = array.cbegin();
+    EXPECT_EQ(Number::UINT, it->as_number().type());
+    EXPECT_EQ(0, Int(*it));
+    ++it;
+    EXPECT_EQ(42, Int(*it));
+    ++it;
+    EXPECT_EQ(Number::INT, it->as_number().type());
+    EXPECT_EQ(-7, Int(*it));
+    ++it;
+    EXPECT_EQ(Number::DOUBLE, it->as_number().type());
+    EXPECT_DOUBLE_EQ(1.5, Double(*it));
+    ++it;
+    EXPECT_DOUBLE_EQ(-250.0, Double(*it));
+    ++it;
+    EXPECT_DOUBLE_EQ(2.5, Double(*it));
+}
+
+TEST(TestParser, Strings) {
+    Parser parser;
+
+    parse(parser, R"(["", "text", "a\"b\\c\/d\n\t", "Aé😀"])");
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(4, array.size());
+    auto it = array.cbegin();
+    EXPECT_EQ("", to_string(it->as_string()));
+    ++it;
+    EXPECT_EQ("text", to_string(it->as_string()));
+    ++it;
+    EXPECT_EQ("a\"b\\c/d\n\t", to_string(it->as_string()));
+    ++it;
+    EXPECT_EQ("A\xC3\xA9\xF0\x9F\x98\x80", to_string(it->as_string()));
+}
+
+TEST(TestParser, Utf8String) {
+    Parser parser;
+
+    parse(parser, "[\"za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87\"]");
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(1, array.size());
+    EXPECT_EQ("za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87",
+            to_string(array.front().as_string()));
+}
+
+TEST(TestParser, Utf8Sequences) {
+    const std::string text{"a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xEF\xBF\xBD"};
+    const std::string document = "[\"" + text + "\", \"\\u00e9\\ud83d\\ude00\"]";
+
+    for (std::size_t split = 0; split <= document.size(); ++split) {
+        Parser parser;
+
+        parser.parse(document.data(), split);
+        parser.parse(document.data() + split, document.size() - split);
+
+        ASSERT_EQ(json::Status::COMPLETE, parser.finish());
+
+        const auto& array = parser.value().as_array();
+
+        EXPECT_EQ(text, to_string(array.front().as_string()));
+        EXPECT_EQ("\xC3\xA9\xF0\x9F\x98\x80",
+                to_string(array.back().as_string()));
+    }
+}
+
+TEST(TestParser, Utf8Invalid) {
+    const char* invalid[] = {
+        "[\"\x80\"]",
+        "[\"\xC0\xAF\"]",
+        "[\"\xC3\"]",
+        "[\"\xE0\x80\xAF\"]",
+        "[\"\xED\xA0\x80\"]",
+        "[\"\xF4\x90\x80\x80\"]",
+        "[\"\xF5\x80\x80\x80\"]",
+        "[\"\xE2\x82\"]",
+        "[\xC3\xA9]"
+    };
+
+    for (auto document : invalid) {
+        Parser parser;
+        parse(parser, document);
+        EXPECT_EQ(json::Status::ERROR, parser.finish()) << document;
+    }
+
+    Parser parser;
+    parse(parser, "[\"ab\xE2\x28\xA1\"]");
+    EXPECT_EQ(json::Status::ERROR, parser.status());
+    EXPECT_EQ(5, parser.offset());
+}
+
+TEST(TestParser, Object) {
+    Parser parser;
+
+    parse(parser, R"({"id": 1, "tags": ["a", "b"], "inner": {"key": null}})");
+
+    const auto& object = parser.value().as_object();
+
+    ASSERT_EQ(3, object.size());
+    auto it = object.cbegin();
+    EXPECT_EQ("id", to_string(it->name()));
+    EXPECT_EQ(1, Int(it->value()));
+    EXPECT_EQ(&parser.value(), it->value().parent());
+    ++it;
+    EXPECT_EQ("tags", to_string(it->name()));
+    ASSERT_TRUE(it->value().is_array());
+    EXPECT_EQ(2, it->value().size());
+    EXPECT_EQ(&it->value(), it->value().as_array().front().parent());
+    ++it;
+    EXPECT_EQ("inner", to_string(it->name()));
+    ASSERT_TRUE(it->value().is_object());
+    EXPECT_EQ("key", to_string(it->value().as_object().front().name()));
+    EXPECT_TRUE(it->value().as_object().front().value().is_null());
+}
+
+TEST(TestParser, DeepNesting) {
+    static constexpr std::size_t DEPTH{1000};
+
+    std::string document(DEPTH, '[');
+    document += "1";
+    document += std::string(DEPTH, ']');
+
+    Parser parser;
+    parser.parse(document.data(), document.size());
+
+    const Value* value = &parser.value();
+
+    for (std::size_t i = 0; i < DEPTH; ++i) {
+        ASSERT_TRUE(value->is_array());
+        ASSERT_EQ(1, value->size());
+        value = &value->as_array().front();
+    }
+
+    EXPECT_EQ(1, Int(*value));
+}
+
+TEST(TestParser, ByteByByte) {
+    const char document[] =
+        R"({"name": "value with spaces", "list": [1, 2.5, "x y"]})";
+
+    Parser parser;
+
+    for (auto ch : document) {
+        if (ch) {
+            parser.put(ch);
+        }
+    }
+
+    const auto& object = parser.value().as_object();
+
+    ASSERT_EQ(2, object.size());
+    EXPECT_EQ("value with spaces", to_string(object.front().value().as_string()));
+    EXPECT_EQ("x y",
+            to_string(object.back().value().as_array().back().as_string()));
+}
+
+TEST(TestParser, LongStrings) {
+    std::string text(1000, 'x');
+    text[500] = ' ';
+    std::string document = "{\"" + text + "\": \"" + text + "\"}";
+
+    Parser parser;
+    parser.parse(document.data(), document.size());
+
+    const auto& object = parser.value().as_object();
+
+    ASSERT_EQ(1, object.size());
+    EXPECT_EQ(text, to_string(object.front().name()));
+    EXPECT_EQ(text, to_string(object.front().value().as_string()));
+}
+
+TEST(TestParser, LongStringRuns) {
+    std::string text(300, 'x');
+    text.replace(100, 2, "\xC3\xA9");
+    text[200] = '\n';
+
+    std::string escaped{text};
+    escaped.replace(200, 1, "\\n");
+
+    std::string document = "[\"" + escaped + "\", \"" + escaped + "\xC3\"]";
+
+    Parser parser;
+    parser.parse(document.data(), document.size());
+
+    EXPECT_EQ(json::ParseError::INVALID_UTF8, parser.error().code());
+    EXPECT_EQ((2 * escaped.size()) + 7, parser.offset());
+
+    document = "[\"" + escaped + "\"]";
+
+    parser.restart();
+    parser.parse(document.data(), document.size());
+
+    EXPECT_EQ(text, to_string(parser.value().as_array().front().as_string()));
+}
+
+TEST(TestParser, Reset) {
+    const std::string broken{"{\"a\": [1, \"xy"};
+    const std::string document{"[\"b\", {\"c\": 2}]"};
+
+    Parser parser;
+    parser.parse(broken.data(), broken.size());
+
+    EXPECT_EQ(json::Status::ERROR, parser.finish());
+    EXPECT_EQ(json::ParseError::UNEXPECTED_END, parser.error().code());
+
+    parser.reset();
+    parser.parse(document.data(), document.size());
+
+    ASSERT_EQ(json::Status::COMPLETE, parser.finish());
+    EXPECT_EQ(json::ParseError::NONE, parser.error().code());
+    EXPECT_EQ(document.size(), parser.offset());
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(2, array.size());
+    EXPECT_EQ("b", to_string(array.front().as_string()));
+    EXPECT_EQ(2, json::Int(array.back().as_object().front().value()));
+}
+
+TEST(TestParser, LongFractions) {
+    Parser parser;
+
+    parse(parser, "[0.000000015, 1.23456789012, 3.1234567e2]");
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(3, array.size());
+    auto it = array.cbegin();
+    EXPECT_EQ(0.000000015, Double(*it));
+    EXPECT_EQ(1.23456789012, Double(*++it));
+    EXPECT_EQ(312.34567, Double(*++it));
+}
+
+TEST(TestParser, IntegerLimits) {
+    Parser parser;
+
+    parse(parser, "[18446744073709551615, 18446744073709551616, "
+            "-9223372036854775808, -9223372036854775809, "
+            "12345678901234567]");
+
+    const auto& array = parser.value().as_array();
+
+    ASSERT_EQ(5, array.size());
+    auto it = array.cbegin();
+    EXPECT_EQ(Number::UINT, it->as_number().type());
+    EXPECT_EQ(18446744073709551615u, json::Uint(*it));
+    ++it;
+    EXPECT_EQ(Number::DOUBLE, it->as_number().type());
+    EXPECT_EQ(18446744073709551616.0, Double(*it));
+    ++it;
+    EXPECT_EQ(Number::INT, it->as_number().type());
+    EXPECT_EQ(INT64_MIN, Int(*it));
+    ++it;
+    EXPECT_EQ(Number::DOUBLE, it->as_number().type());
+    EXPECT_EQ(-9223372036854775809.0, Double(*it));
+    ++it;
+    EXPECT_EQ(Number::UINT, it->as_number().type());
+    EXPECT_EQ(12345678901234567u, json::Uint(*it));
+}
+
+TEST(TestParser, FloatingRounding) {
+    const char document[] = "[0.1, 1e23, 9007199254740993, "
+        "2.2250738585072011e-308, 4.9406564584124654e-324, "
+        "1.7976931348623157e308, 3.14159265358979323846264338327950288, "
+        "1e-400, -0.0, 1e400, "
+        "9007199254740993.00000000000000000000000000000000000000001]";
+
+    const Double expected[] = {0.1, 1e23, 9007199254740993.0,
+        2.2250738585072011e-308, 4.9406564584124654e-324,
+        1.7976931348623157e308, 3.14159265358979323846264338327950288,
+        0.0, -0.0, HUGE_VAL, 9007199254740994.0};
+
+    Parser parser;
+    parse(parser, document);
+
+    Parser parser_put;
+    for (auto ch : document) {
+        if (ch) {
+            parser_put.put(ch);
+        }
+    }
+
+    for (const auto* value : {&parser.value(), &parser_put.value()}) {
+        ASSERT_EQ(11, value->size());
+
+        std::size_t index = 0;
+        for (const auto& number : value->as_array()) {
+            auto parsed = Double(number);
+            EXPECT_EQ(0, std::memcmp(&parsed, &expected[index],
+                        sizeof(parsed))) << index;
+            ++index;
+        }
+    }
+}
+
+namespace {
+
+class Counter : public json::Handler<Counter> {
+public:
+    bool number(const Number& value) noexcept {
+        sum += Int(value);
+        return true;
+    }
+
+    bool key(const json::StringView& value) noexcept {
+        keys += std::string{value.data(), value.size()};
+        return true;
+    }
+
+    bool start_array() noexcept {
+        ++arrays;
+        return true;
+    }
+
+    bool end_object() noexcept {
+        ++objects;
+        return objects < 2;
+    }
+
+    Int sum{0};
+    std::string keys{};
+    unsigned arrays{0};
+    unsigned objects{0};
+};
+
+}
+
+TEST(TestParser, Handler) {
+    const char document[] = R"([{"a": 1, "b": [2, 3]}, {"c": 4}, {"d": 5}])";
+
+    Counter counter;
+    json::BasicParser<Counter> parser{counter};
+
+    parser.parse(document, sizeof(document) - 1);
+
+    EXPECT_EQ(10, counter.sum);
+    EXPECT_EQ("abc", counter.keys);
+    EXPECT_EQ(2, counter.arrays);
+    EXPECT_EQ(2, counter.objects);
+}
+
+TEST(TestParser, Chunks) {
+    const std::string document =
+        "{\"name\": \"za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87 \\u00e9\", "
+        "\"list\": [12345678901, -2.5e-3, true, null]}";
+
+    for (std::size_t split = 1; split < document.size(); ++split) {
+        Parser parser;
+
+        EXPECT_EQ(json::Status::NEED_MORE, parser.parse(document.data(), split));
+        ASSERT_EQ(json::Status::COMPLETE, parser.parse(document.data() + split,
+                    document.size() - split)) << split;
+        EXPECT_EQ(document.size(), parser.offset());
+
+        const auto& object = parser.value().as_object();
+
+        ASSERT_EQ(2, object.size());
+        EXPECT_EQ("za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87 \xC3\xA9",
+                to_string(object.front().value().as_string()));
+        EXPECT_EQ(12345678901, Int(object.back().value().as_array().front()));
+    }
+}
+
+TEST(TestParser, Status) {
+    Parser parser;
+
+    EXPECT_EQ(json::Status::NEED_MORE, parser.parse("  42", 4));
+    EXPECT_EQ(json::Status::COMPLETE, parser.finish());
+    EXPECT_EQ(42, Int(parser.value()));
+
+    Parser truncated;
+
+    EXPECT_EQ(json::Status::NEED_MORE, truncated.parse("[1, 2", 5));
+    EXPECT_EQ(json::Status::ERROR, truncated.finish());
+
+    Parser invalid;
+
+    EXPECT_EQ(json::Status::NEED_MORE, invalid.parse("[1, ", 4));
+    EXPECT_EQ(json::Status::ERROR, invalid.parse("2, x]", 5));
+    EXPECT_EQ(7, invalid.offset());
+    EXPECT_EQ(json::Status::ERROR, invalid.parse("]", 1));
+    EXPECT_EQ(7, invalid.offset());
+}
+
+TEST(TestParser, ErrorCodes) {
+    using json::ParseError;
+
+    const struct {
+        const char* document;
+        ParseError::Code code;
+        json::Size offset;
+    } cases[] = {
+        {"[1, 2]", ParseError::NONE, 0},
+        {"[1, }", ParseError::UNEXPECTED_CHARACTER, 4},
+        {"[1, 2", ParseError::UNEXPECTED_END, 5},
+        {"{} x", ParseError::TRAILING_CHARACTERS, 3},
+        {"[nul]", ParseError::INVALID_LITERAL, 4},
+        {"[-]", ParseError::INVALID_NUMBER, 2},
+        {"[1.e5]", ParseError::INVALID_NUMBER, 3},
+        {"[\"a\tb\"]", ParseError::CONTROL_CHARACTER, 3},
+        {"[\"\\x\"]", ParseError::INVALID_ESCAPE, 3},
+        {"[\"\\u12g4\"]", ParseError::INVALID_UNICODE_ESCAPE, 6},
+        {"[\"\\uDC00\"]", ParseError::INVALID_UNICODE_ESCAPE, 7},
+        {"[\"\xC3\x28\"]", ParseError::INVALID_UTF8, 3},
+        {"[1}", ParseError::MISMATCHED_BRACKET, 2}
+    };
+
+    for (const auto& test : cases) {
+        Parser parser;
+
+        parse(parser, test.document);
+        parser.finish();
+
+        auto error = parser.error();
+
+        EXPECT_EQ(test.code, error.code()) << test.document;
+        EXPECT_EQ(ParseError::NONE != test.code, bool(error)) << test.document;
+
+        if (error) {
+            EXPECT_EQ(test.offset, error.offset()) << test.document;
+            EXPECT_STRNE("unknown error", error.message());
+        }
+    }
+}
+
+TEST(TestParser, ErrorPosition) {
+    const char* chunks[] = {"{\n  \"a\": [1,\n", "    2],\n  \"b\"", ": x\n}"};
+
+    Parser parser;
+
+    for (const auto* chunk : chunks) {
+        parse(parser, chunk);
+    }
+
+    auto error = parser.error();
+
+    EXPECT_EQ(json::ParseError::UNEXPECTED_CHARACTER, error.code());
+    EXPECT_EQ(28, error.offset());
+    EXPECT_EQ(4, error.line());
+    EXPECT_EQ(8, error.column());
+
+    Parser bytes;
+
+    for (auto ch : std::string{"[\n1,\n\n2 3]"}) {
+        bytes.put(ch);
+    }
+
+    error = bytes.error();
+
+    EXPECT_EQ(8, error.offset());
+    EXPECT_EQ(4, error.line());
+    EXPECT_EQ(3, error.column());
+}
+
+TEST(TestParser, InSitu) {
+    char document[] = R"({"plain": "text", "esc\"aped": "a\\bé\n", "n": 1})";
+
+    Parser parser;
+
+    ASSERT_EQ(json::Status::COMPLETE,
+            parser.parse_in_situ(document, sizeof(document) - 1));
+
+    const auto& object = parser.value().as_object();
+    auto in_buffer = [&document] (const json::String& str) {
+        return str.borrowed() && (str.data() >= document) &&
+            ((str.data() + str.size()) <= (document + sizeof(document)));
+    };
+
+    ASSERT_EQ(3, object.size());
+    auto it = object.cbegin();
+    EXPECT_EQ("plain", to_string(it->name()));
+    EXPECT_EQ("text", to_string(it->value().as_string()));
+    EXPECT_TRUE(in_buffer(it->name()));
+    EXPECT_TRUE(in_buffer(it->value().as_string()));
+    ++it;
+    EXPECT_EQ("esc\"aped", to_string(it->name()));
+    EXPECT_EQ("a\\b\xC3\xA9\n", to_string(it->value().as_string()));
+    EXPECT_TRUE(in_buffer(it->name()));
+    EXPECT_TRUE(in_buffer(it->value().as_string()));
+    ++it;
+    EXPECT_EQ(1, Int(it->value()));
+
+    Value copy{parser.value()};
+
+    EXPECT_FALSE(copy.as_object().front().value().as_string().borrowed());
+}
+
+TEST(TestParser, InSituTruncated) {
+    json::allocator::Standard standard;
+
+    for (auto text : {"\"abc", "[\"", "{\"k\":\"v", "[\"a\\", "\"\\u12"}) {
+        auto size = std::strlen(text);
+
+        /* Exactly sized, writing past the input is caught by sanitizers */
+        std::unique_ptr<char[]> document{new char[size]};
+        std::memcpy(document.get(), text, size);
+
+        Parser parser{standard};
+
+        EXPECT_EQ(json::Status::ERROR,
+                parser.parse_in_situ(document.get(), size)) << text;
+        EXPECT_EQ(json::ParseError::UNEXPECTED_END, parser.error().code())
+            << text;
+
+        std::memcpy(document.get(), text, size);
+
+        Parser block_parser;
+
+        EXPECT_EQ(json::Status::ERROR,
+                block_parser.parse_in_situ(document.get(), size)) << text;
+    }
+}
+
+TEST(TestParser, RawNumbers) {
+    char document[] =
+        "[1, -2, 3.250, 123456789012345678901234567890, -0, 1e2, 7]";
+
+    Parser parser;
+    parser.set_raw_numbers(true);
+
+    ASSERT_EQ(json::Status::COMPLETE,
+            parser.parse_in_situ(document, sizeof(document) - 1));
+
+    auto it = parser.value().as_array().cbegin();
+    auto raw = [] (const Value& value) {
+        auto text = value.as_number().raw();
+        return std::string{text.data(), text.size()};
+    };
+
+    EXPECT_TRUE(it->as_number().is_raw());
+    EXPECT_EQ(document + 1, it->as_number().raw().data());
+    EXPECT_TRUE(it->as_number().is_unsigned());
+    EXPECT_EQ(1, Int(*it));
+    ++it;
+    EXPECT_EQ("-2", raw(*it));
+    EXPECT_TRUE(it->as_number().is_signed());
+    EXPECT_TRUE(it->as_number().is_integral());
+    EXPECT_EQ(-2, Int(*it));
+    ++it;
+    EXPECT_EQ("3.250", raw(*it));
+    EXPECT_TRUE(it->as_number().is_floating_point());
+    EXPECT_DOUBLE_EQ(3.25, Double(*it));
+    ++it;
+    EXPECT_EQ("123456789012345678901234567890", raw(*it));
+    EXPECT_TRUE(it->as_number().is_floating_point());
+    EXPECT_DOUBLE_EQ(1.2345678901234568e29, Double(*it));
+    ++it;
+    EXPECT_EQ("-0", raw(*it));
+    EXPECT_EQ(0, Int(*it));
+    ++it;
+    EXPECT_EQ("1e2", raw(*it));
+    EXPECT_EQ(Number{100.0}, it->as_number());
+    ++it;
+    EXPECT_EQ("7", raw(*it));
+    EXPECT_FALSE(it->as_number().converted().is_raw());
+    EXPECT_EQ(7, Int(it->as_number().converted()));
+
+    /* Outside of in situ buffers numbers are converted */
+    Parser copying;
+    copying.set_raw_numbers(true);
+
+    ASSERT_EQ(json::Status::COMPLETE, copying.parse(document,
+                sizeof(document) - 1));
+    EXPECT_FALSE(copying.value().as_array().front().as_number().is_raw());
+    EXPECT_EQ(1, Int(copying.value().as_array().front()));
+}
+
+namespace {
+
+class Texts : public json::Handler<Texts> {
+public:
+    bool number(const Number& value) noexcept {
+        texts += std::string{value.raw().data(), value.raw().size()} + " ";
+        return value.is_raw();
+    }
+
+    std::string texts{};
+};
+
+}
+
+TEST(TestParser, RawNumbersHandler) {
+    const char document[] = "[0.10, 2E+3, -12345678901234567890123]";
+
+    Texts texts;
+    json::BasicParser<Texts> parser{texts};
+    parser.set_raw_numbers(true);
+
+    EXPECT_TRUE(parser.raw_numbers());
+    EXPECT_EQ(json::Status::COMPLETE,
+            parser.parse(document, sizeof(document) - 1));
+    EXPECT_EQ("0.10 2E+3 -12345678901234567890123 ", texts.texts);
+}
+
+namespace {
+
+class Selector : public json::Handler<Selector> {
+public:
+    bool number(const Number& value) noexcept {
+        events += std::to_string(Int(value)) + " ";
+        return true;
+    }
+
+    bool string(const json::StringView& value) noexcept {
+        events += std::string{value.data(), value.size()} + " ";
+        return true;
+    }
+
+    bool key(const json::StringView& value) noexcept {
+        if ('_' == value[0]) {
+            parser->skip_value();
+        }
+        return true;
+    }
+
+    bool start_array() noexcept {
+        events += "[ ";
+        if (skip_arrays) {
+            parser->skip_value();
+        }
+        return true;
+    }
+
+    bool end_array() noexcept {
+        events += "] ";
+        return true;
+    }
+
+    json::BasicParser<Selector>* parser{nullptr};
+    std::string events{};
+    bool skip_arrays{false};
+};
+
+}
+
+TEST(TestParser, SkipValue) {
+    const std::string document = R"({"_a": {"x": [1, "]}\"", {"y": [[]]}]},
+        "b": 1, "_c": "skip \"}\" me", "d": "kept", "_e": 12.5e3,
+        "f": [2, 3], "_g": true, "h": 4})";
+
+    for (std::size_t split = 1; split < document.size(); ++split) {
+        Selector selector;
+        json::BasicParser<Selector> parser{selector};
+        selector.parser = &parser;
+
+        parser.parse(document.data(), split);
+        ASSERT_EQ(json::Status::COMPLETE, parser.parse(document.data() + split,
+                    document.size() - split)) << split;
+        EXPECT_EQ("1 kept [ 2 3 ] 4 ", selector.events) << split;
+    }
+
+    Selector selector;
+    json::BasicParser<Selector> parser{selector};
+    selector.parser = &parser;
+
+    for (auto ch : document) {
+        parser.put(ch);
+    }
+
+    EXPECT_EQ(json::Status::COMPLETE, parser.status());
+    EXPECT_EQ("1 kept [ 2 3 ] 4 ", selector.events);
+
+    Selector arrays;
+    json::BasicParser<Selector> arrays_parser{arrays};
+    arrays.parser = &arrays_parser;
+    arrays.skip_arrays = true;
+
+    const char list[] = R"([1, [2, "[", 3], 4])";
+
+    EXPECT_EQ(json::Status::COMPLETE, arrays_parser.parse(list,
+                sizeof(list) - 1));
+    EXPECT_EQ("[ ", arrays.events);
+}
+
+TEST(TestParser, SkipLongValue) {
+    std::string document = R"({"_big": [)";
+
+    for (int i = 0; i < 1000; ++i) {
+        document += R"({"s": "\\\"]}[{", "n": [)" + std::to_string(i) + "]},";
+    }
+
+    document += R"("end"], "k": 7, "_s": ")" + std::string(500, 'x') +
+        R"(", "_n": 123456789012345678901234567890, "m": 8})";
+
+    Selector selector;
+    json::BasicParser<Selector> parser{selector};
+    selector.parser = &parser;
+
+    EXPECT_EQ(json::Status::COMPLETE,
+            parser.parse(document.data(), document.size()));
+    EXPECT_EQ("7 8 ", selector.events);
+}
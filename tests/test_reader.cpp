@@ -0,0 +1,165 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_reader.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/reader.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <cstring>
+
+using json::Reader;
+
+static std::string to_string(const json::StringView& str) {
+    return {str.data(), str.size()};
+}
+
+TEST(TestReader, Tokens) {
+    const char document[] =
+        R"({"id": 7, "tags": ["a", true, null], "pi": 3.25, "e": {}})";
+
+    Reader reader{document, sizeof(document) - 1};
+
+    const Reader::TokenType expected[] = {
+        Reader::START_OBJECT,
+        Reader::KEY, Reader::NUMBER,
+        Reader::KEY, Reader::START_ARRAY, Reader::STRING, Reader::BOOLEAN,
+        Reader::NIL, Reader::END_ARRAY,
+        Reader::KEY, Reader::NUMBER,
+        Reader::KEY, Reader::START_OBJECT, Reader::END_OBJECT,
+        Reader::END_OBJECT
+    };
+
+    const std::size_t depths[] = {1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 2, 1, 0};
+
+    std::string strings;
+    std::size_t index = 0;
+
+    while (reader.next()) {
+        ASSERT_LT(index, sizeof(expected) / sizeof(expected[0]));
+        EXPECT_EQ(expected[index], reader.token_type()) << index;
+        EXPECT_EQ(depths[index], reader.depth()) << index;
+
+        if ((Reader::KEY == reader.token_type()) ||
+                (Reader::STRING == reader.token_type())) {
+            strings += to_string(reader.get_string_view()) + " ";
+        }
+
+        ++index;
+    }
+
+    EXPECT_EQ(sizeof(expected) / sizeof(expected[0]), index);
+    EXPECT_EQ(json::Status::COMPLETE, reader.status());
+    EXPECT_EQ(Reader::NONE, reader.token_type());
+    EXPECT_EQ("id tags a pi e ", strings);
+}
+
+TEST(TestReader, Values) {
+    const char document[] = "[12, -3.5, false]";
+
+    Reader reader{document, sizeof(document) - 1};
+
+    ASSERT_TRUE(reader.next());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(12, json::Int(reader.get_number()));
+    ASSERT_TRUE(reader.next());
+    EXPECT_DOUBLE_EQ(-3.5, json::Double(reader.get_number()));
+    ASSERT_TRUE(reader.next());
+    EXPECT_FALSE(reader.get_bool());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(Reader::END_ARRAY, reader.token_type());
+    EXPECT_FALSE(reader.next());
+}
+
+TEST(TestReader, Scalar) {
+    Reader reader{"42", 2};
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(Reader::NUMBER, reader.token_type());
+    EXPECT_EQ(42, json::Int(reader.get_number()));
+    EXPECT_EQ(0, reader.depth());
+    EXPECT_FALSE(reader.next());
+    EXPECT_EQ(json::Status::COMPLETE, reader.status());
+}
+
+TEST(TestReader, SkipValue) {
+    const char document[] =
+        R"({"skip": {"a": [1, "}"]}, "list": [[1, 2], 3], "k": 4})";
+
+    Reader reader{document, sizeof(document) - 1};
+    std::string tokens;
+
+    while (reader.next()) {
+        switch (reader.token_type()) {
+        case Reader::KEY:
+            tokens += to_string(reader.get_string_view()) + " ";
+            if ("skip" == to_string(reader.get_string_view())) {
+                reader.skip_value();
+            }
+            break;
+        case Reader::START_ARRAY:
+            tokens += "[ ";
+            if (3 == reader.depth()) {
+                tokens += "] ";
+            }
+            break;
+        case Reader::END_ARRAY:
+            tokens += "] ";
+            break;
+        case Reader::NUMBER:
+            tokens += std::to_string(json::Int(reader.get_number())) + " ";
+            break;
+        case Reader::NONE:
+        case Reader::NIL:
+        case Reader::BOOLEAN:
+        case Reader::STRING:
+        case Reader::START_OBJECT:
+        case Reader::END_OBJECT:
+        default:
+            break;
+        }
+
+        if ((Reader::START_ARRAY == reader.token_type()) &&
+                (3 == reader.depth())) {
+            reader.skip_value();
+        }
+    }
+
+    EXPECT_EQ(json::Status::COMPLETE, reader.status());
+    EXPECT_EQ("skip list [ [ ] 3 ] k 4 ", tokens);
+}
+
+TEST(TestReader, Error) {
+    const char document[] = "[1, 2 3]";
+
+    Reader reader{document, sizeof(document) - 1};
+
+    EXPECT_TRUE(reader.next());
+    EXPECT_TRUE(reader.next());
+    EXPECT_TRUE(reader.next());
+    EXPECT_EQ(2, json::Int(reader.get_number()));
+    EXPECT_FALSE(reader.next());
+    EXPECT_EQ(json::Status::ERROR, reader.status());
+    EXPECT_EQ(6, reader.offset());
+}
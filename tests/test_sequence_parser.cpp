@@ -0,0 +1,143 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_sequence_parser.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/sequence_parser.hpp"
+#include "json/pair.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+using json::Int;
+using json::Value;
+using json::SequenceParser;
+
+TEST(TestSequenceParser, Concatenated) {
+    const char document[] = R"({"a": 1}{"b": [2]}[3, 4] "five"
+        true null 6 )";
+
+    SequenceParser parser{document, sizeof(document) - 1};
+    std::vector<Value::Type> types;
+
+    for (auto& value : parser) {
+        types.push_back(value.type());
+    }
+
+    const std::vector<Value::Type> expected{Value::OBJECT, Value::OBJECT,
+        Value::ARRAY, Value::STRING, Value::BOOLEAN, Value::NIL, Value::NUMBER};
+
+    EXPECT_EQ(expected, types);
+    EXPECT_EQ(json::Status::COMPLETE, parser.status());
+    EXPECT_FALSE(parser.error());
+    EXPECT_EQ(6, Int(parser.value()));
+}
+
+TEST(TestSequenceParser, Offsets) {
+    const char document[] = "[1]{}\n[[2], 3]";
+
+    SequenceParser parser{document, sizeof(document) - 1};
+
+    ASSERT_TRUE(parser.next());
+    EXPECT_EQ(3, parser.offset());
+    EXPECT_EQ(1, Int(parser.value().as_array().front()));
+
+    ASSERT_TRUE(parser.next());
+    EXPECT_EQ(5, parser.offset());
+    EXPECT_TRUE(parser.value().as_object().empty());
+
+    ASSERT_TRUE(parser.next());
+    EXPECT_EQ(14, parser.offset());
+    EXPECT_EQ(3, Int(parser.value().as_array().back()));
+
+    EXPECT_FALSE(parser.next());
+    EXPECT_EQ(json::Status::COMPLETE, parser.status());
+}
+
+TEST(TestSequenceParser, TrailingNumber) {
+    SequenceParser parser{"{} 42", 5};
+
+    ASSERT_TRUE(parser.next());
+    ASSERT_TRUE(parser.next());
+    EXPECT_EQ(42, Int(parser.value()));
+    EXPECT_FALSE(parser.next());
+    EXPECT_EQ(json::Status::COMPLETE, parser.status());
+}
+
+TEST(TestSequenceParser, Empty) {
+    SequenceParser empty{"", 0};
+
+    EXPECT_FALSE(empty.next());
+    EXPECT_EQ(json::Status::COMPLETE, empty.status());
+
+    SequenceParser blank{" \n\t ", 4};
+
+    EXPECT_TRUE(blank.begin() == blank.end());
+    EXPECT_EQ(json::Status::COMPLETE, blank.status());
+}
+
+TEST(TestSequenceParser, Errors) {
+    const char document[] = "{}[1, }{}";
+
+    SequenceParser parser{document, sizeof(document) - 1};
+
+    EXPECT_TRUE(parser.next());
+    EXPECT_FALSE(parser.next());
+    EXPECT_FALSE(parser.next());
+    EXPECT_EQ(json::Status::ERROR, parser.status());
+    EXPECT_EQ(json::ParseError::UNEXPECTED_CHARACTER, parser.error().code());
+    EXPECT_EQ(6, parser.error().offset());
+
+    SequenceParser truncated{"[1] [2", 6};
+
+    EXPECT_TRUE(truncated.next());
+    EXPECT_FALSE(truncated.next());
+    EXPECT_EQ(json::ParseError::UNEXPECTED_END, truncated.error().code());
+}
+
+TEST(TestSequenceParser, Chunks) {
+    const char* chunks[] = {"{\"a\":", " 1}[", "2]"};
+
+    json::Parser parser;
+    std::vector<Value::Type> types;
+
+    for (const auto* chunk : chunks) {
+        auto size = std::strlen(chunk);
+        json::Size begin = parser.offset();
+
+        while (json::Status::COMPLETE ==
+                parser.parse_one(chunk + (parser.offset() - begin),
+                    size - (parser.offset() - begin))) {
+            types.push_back(parser.value().type());
+            parser.restart();
+
+            if (parser.offset() - begin == size) {
+                break;
+            }
+        }
+    }
+
+    EXPECT_EQ((std::vector<Value::Type>{Value::OBJECT, Value::ARRAY}), types);
+}
@@ -148,3 +148,27 @@ TEST(TestString, Constructor9) {
                 "b"
             ));
 }
+
+TEST(TestString, Borrow) {
+    char buffer[] = "borrowed";
+    String string;
+
+    string.borrow(buffer, 6);
+
+    EXPECT_TRUE(string.borrowed());
+    EXPECT_EQ(buffer, string.data());
+    EXPECT_EQ(6, string.size());
+
+    String moved{std::move(string)};
+
+    EXPECT_TRUE(moved.borrowed());
+    EXPECT_EQ(buffer, moved.data());
+
+    moved.push_back('!');
+
+    EXPECT_FALSE(moved.borrowed());
+    EXPECT_NE(buffer, moved.data());
+    EXPECT_EQ(7, moved.size());
+    EXPECT_TRUE(std::equal(moved.cbegin(), moved.cend(), "borrow!"));
+    EXPECT_EQ('e', buffer[6]);
+}
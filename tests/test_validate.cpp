@@ -0,0 +1,97 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * @file test_validate.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/validate.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+using json::validate;
+
+static json::Validation check(const std::string& document) {
+    return validate(document.data(), document.size());
+}
+
+TEST(TestValidate, Valid) {
+    EXPECT_TRUE(check(R"({"a": [1, -2.5e3, "x\u00e9\"", true, null]})"));
+    EXPECT_TRUE(check(" 42 "));
+    EXPECT_TRUE(check("\"" + std::string(100000, 'x') + "\""));
+    EXPECT_TRUE(check("\"za\xC5\xBC\xC3\xB3\xC5\x82\xC4\x87\""));
+}
+
+TEST(TestValidate, Errors) {
+    auto result = check("{\n  \"a\": [1, 2],\n  \"b\": tru\n}");
+
+    EXPECT_FALSE(result);
+    EXPECT_EQ(27, result.offset());
+    EXPECT_EQ(3, result.line());
+    EXPECT_EQ(11, result.column());
+    EXPECT_EQ(json::ParseError::INVALID_LITERAL, result.error().code());
+
+    result = check("[1, 2");
+    EXPECT_FALSE(result.is_valid());
+    EXPECT_EQ(1, result.line());
+
+    result = check("[\"\xC3\x28\"]");
+    EXPECT_FALSE(result);
+    EXPECT_EQ(1, result.line());
+
+    EXPECT_FALSE(check(""));
+    EXPECT_FALSE(check("{} {}"));
+}
+
+TEST(TestValidate, Depth) {
+    auto depth = json::VALIDATE_DEPTH_MAX;
+
+    EXPECT_TRUE(check(std::string(depth, '[') + std::string(depth, ']')));
+
+    auto result = check(std::string(depth + 1, '[') +
+            std::string(depth + 1, ']'));
+
+    EXPECT_FALSE(result);
+    EXPECT_EQ(depth, result.offset());
+    EXPECT_EQ(json::ParseError::DEPTH_LIMIT, result.error().code());
+}
+
+TEST(TestValidate, DepthMixed) {
+    std::string document;
+
+    for (json::Size i = 0; i < json::VALIDATE_DEPTH_MAX / 2; ++i) {
+        document += "{\"a\":[1,";
+    }
+
+    document += "null";
+
+    for (json::Size i = 0; i < json::VALIDATE_DEPTH_MAX / 2; ++i) {
+        document += "],\"b\":2}";
+    }
+
+    EXPECT_TRUE(check(document));
+
+    document[document.size() - 1] = ']';
+
+    EXPECT_EQ(json::ParseError::MISMATCHED_BRACKET,
+            check(document).error().code());
+}
@@ -0,0 +1,254 @@
+/*!
+ * @copyright
+ * Copyright 2017 Tymoteusz Blazejczyk
+ *
+ * @copyright
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * @copyright
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * @copyright
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ * @file test_writer.cpp
+ *
+ * @brief Implementation
+ */
+
+#include "json/writer.hpp"
+#include "json/parser.hpp"
+#include "json/floating.hpp"
+#include "json/sink/fixed.hpp"
+#include "json/sink/buffer.hpp"
+#include "json/sink/file.hpp"
+#include "json/sink/callback.hpp"
+#include "json/allocator/standard.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <cstdio>
+#include <cstring>
+
+using json::Writer;
+using json::Number;
+using json::StringView;
+
+static StringView view(const char* text) {
+    return StringView{text, std::strlen(text)};
+}
+
+static std::string to_string(const json::sink::Buffer& buffer) {
+    return std::string{buffer.data(), buffer.size()};
+}
+
+static std::string rewrite(const char* text) {
+    json::allocator::Standard allocator;
+    json::Parser parser{allocator};
+    json::sink::Buffer buffer{allocator};
+
+    EXPECT_EQ(json::Status::COMPLETE, parser.parse(view(text)));
+
+    Writer writer{buffer};
+    EXPECT_TRUE(writer.write(parser.value()));
+    EXPECT_TRUE(writer.flush());
+
+    return to_string(buffer);
+}
+
+TEST(TestWriter, Value) {
+    EXPECT_EQ(R"({"a":[1,-2,true,false,null],"b":{},"c":[],"d":"x"})",
+            rewrite(R"( { "a" : [ 1, -2, true, false, null ],
+                "b" : { }, "c" : [ ], "d" : "x" } )"));
+    EXPECT_EQ("[[[]],{\"\":[{}]}]", rewrite("[[[]],{\"\":[{}]}]"));
+    EXPECT_EQ("\"only\"", rewrite("\"only\""));
+}
+
+TEST(TestWriter, Events) {
+    json::sink::Buffer buffer;
+    Writer writer{buffer};
+
+    writer.start_object();
+    writer.key(view("list"));
+    writer.start_array();
+    writer.number(Number{1u});
+    writer.string(view("two"));
+    writer.end_array();
+    writer.key(view("ok"));
+    writer.boolean(true);
+    writer.end_object();
+    writer.null();
+    writer.flush();
+
+    EXPECT_EQ("{\"list\":[1,\"two\"],\"ok\":true}\nnull", to_string(buffer));
+}
+
+TEST(TestWriter, Escapes) {
+    json::sink::Buffer buffer;
+    Writer writer{buffer};
+
+    const char text[] = "q\"b\\s/\b\f\n\r\t\x01\x1F\xC3\xA9";
+    writer.string(StringView{text, sizeof(text) - 1});
+    writer.flush();
+
+    EXPECT_EQ(R"("q\"b\\s/\b\f\n\r\t\u0001\u001f)" "\xC3\xA9\"",
+            to_string(buffer));
+}
+
+TEST(TestWriter, Numbers) {
+    json::sink::Buffer buffer;
+    Writer writer{buffer};
+
+    writer.start_array();
+    writer.number(Number{std::numeric_limits<json::Int>::min()});
+    writer.number(Number{std::numeric_limits<json::Uint>::max()});
+    writer.number(Number{0});
+    writer.number(Number{0.5});
+    writer.number(Number{-2.0});
+    writer.number(Number{std::numeric_limits<json::Double>::infinity()});
+    writer.number(Number{view("123456789012345678901234567890.10")});
+    writer.number(Number{Number::DOUBLE, "1.000", 5});
+    writer.end_array();
+    writer.flush();
+
+    EXPECT_EQ("[-9223372036854775808,18446744073709551615,0,0.5,-2.0,null,"
+            "123456789012345678901234567890.10,1.000]", to_string(buffer));
+}
+
+TEST(TestWriter, ShortestDoubles) {
+    json::sink::Buffer buffer;
+    Writer writer{buffer};
+
+    writer.start_array();
+    for (auto value : {0.1, 0.30000000000000004, -0.0, 123.456, 1e-5, 0.0001,
+            9007199254740992.0, 1e16, 1e17, 5e-324, 2.2250738585072014e-308,
+            1.7976931348623157e308, 1.0 / 3.0, 100.0}) {
+        writer.number(Number{value});
+    }
+    writer.end_array();
+    writer.flush();
+
+    EXPECT_EQ("[0.1,0.30000000000000004,-0.0,123.456,1e-5,0.0001,"
+            "9007199254740992.0,10000000000000000.0,1e17,5e-324,"
+            "2.2250738585072014e-308,1.7976931348623157e308,"
+            "0.3333333333333333,100.0]", to_string(buffer));
+}
+
+TEST(TestWriter, DoublesRoundTrip) {
+    std::mt19937_64 random{1};
+    json::Char text[json::floating::FORMAT_SIZE];
+
+    for (unsigned i = 0; i < 10000; ++i) {
+        auto bits = random();
+        json::Double value;
+
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (!std::isfinite(value)) {
+            continue;
+        }
+
+        auto size = json::floating::format(value, text);
+        auto result = json::floating::compute(text, size);
+
+        ASSERT_EQ(0, std::memcmp(&value, &result, sizeof(value)))
+            << std::string(text, size);
+    }
+}
+
+TEST(TestWriter, PassThrough) {
+    const char document[] = R"({ "price" : 10.50, "big" : 1e400,
+        "list" : [ 0.1000, -0, 12345678901234567890123 ] })";
+
+    json::sink::Buffer buffer;
+    Writer writer{buffer};
+    json::BasicParser<Writer> parser{writer};
+    parser.set_raw_numbers(true);
+
+    EXPECT_EQ(json::Status::COMPLETE,
+            parser.parse(document, sizeof(document) - 1));
+    writer.flush();
+
+    EXPECT_EQ(R"({"price":10.50,"big":1e400,)"
+            R"("list":[0.1000,-0,12345678901234567890123]})",
+            to_string(buffer));
+}
+
+TEST(TestWriter, FixedSink) {
+    char data[8];
+    json::sink::Fixed fixed{data, sizeof(data)};
+    Writer writer{fixed};
+
+    EXPECT_TRUE(writer.string(view("abc")));
+    EXPECT_TRUE(writer.flush());
+    EXPECT_EQ("\"abc\"", std::string(fixed.data(), fixed.size()));
+
+    EXPECT_FALSE(writer.string(view("too long")));
+    EXPECT_TRUE(writer.is_failed());
+    EXPECT_FALSE(writer.flush());
+}
+
+namespace {
+
+struct Chunks {
+    std::string output{};
+    json::Size count{0};
+};
+
+bool collect(void* context, const json::Char* data, json::Size size) {
+    auto chunks = static_cast<Chunks*>(context);
+    chunks->output.append(data, size);
+    ++chunks->count;
+    return true;
+}
+
+}
+
+TEST(TestWriter, CallbackSink) {
+    Chunks chunks;
+    std::string text(3 * json::sink::Stream::CHUNK_SIZE, 'x');
+
+    {
+        json::sink::Callback callback{collect, &chunks};
+        Writer writer{callback};
+
+        EXPECT_TRUE(writer.string(StringView{text.data(), text.size()}));
+        EXPECT_TRUE(writer.flush());
+    }
+
+    EXPECT_EQ("\"" + text + "\"", chunks.output);
+    EXPECT_EQ(4, chunks.count);
+}
+
+TEST(TestWriter, FileSink) {
+    auto file = std::tmpfile();
+    ASSERT_NE(nullptr, file);
+
+    {
+        json::sink::File sink{file};
+        Writer writer{sink};
+
+        writer.start_array();
+        writer.number(Number{42});
+        writer.end_array();
+    }
+
+    std::rewind(file);
+
+    char data[16]{};
+    auto size = std::fread(data, 1, sizeof(data), file);
+    std::fclose(file);
+
+    EXPECT_EQ("[42]", std::string(data, size));
+}